@@ -0,0 +1,415 @@
+#include "libspd/async/io_uring_spd_executor.h"
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "libspd/errno_error.h"
+
+namespace libspd {
+namespace {
+
+// The largest read submitted at once; longer files are read in several parts
+constexpr size_t kMaxReadSize = 1u << 30;
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, nullptr, 0));
+}
+
+int IoUringRegister(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+// Returns true if the ring supports every operation submitted by the executor.
+// Probing was added in Linux 5.6 along with most of these operations, so
+// earlier kernels that only offer vectored reads fail to probe at all.
+bool SupportsOperations(int fd) {
+  constexpr unsigned kNumOps = 256;
+  std::vector<std::byte> buffer(sizeof(io_uring_probe) +
+                                kNumOps * sizeof(io_uring_probe_op));
+  auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+  if (IoUringRegister(fd, IORING_REGISTER_PROBE, probe, kNumOps) < 0) {
+    return false;
+  }
+
+  for (unsigned op : {IORING_OP_NOP, IORING_OP_OPENAT, IORING_OP_STATX,
+                      IORING_OP_READ}) {
+    if (op > probe->last_op ||
+        !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+T* Offset(void* base, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+}  // namespace
+
+struct IoUringSpdExecutor::Ring {
+  ~Ring() {
+    if (sqes != nullptr) {
+      munmap(sqes, sqes_size);
+    }
+
+    if (cq_ring != nullptr && cq_ring != sq_ring) {
+      munmap(cq_ring, cq_ring_size);
+    }
+
+    if (sq_ring != nullptr) {
+      munmap(sq_ring, sq_ring_size);
+    }
+
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+
+  int fd = -1;
+
+  void* sq_ring = nullptr;
+  size_t sq_ring_size = 0;
+  void* cq_ring = nullptr;
+  size_t cq_ring_size = 0;
+  io_uring_sqe* sqes = nullptr;
+  size_t sqes_size = 0;
+
+  unsigned* sq_tail = nullptr;
+  unsigned sq_mask = 0;
+  unsigned sq_entries = 0;
+  unsigned* sq_array = nullptr;
+
+  unsigned* cq_head = nullptr;
+  unsigned* cq_tail = nullptr;
+  unsigned cq_mask = 0;
+  io_uring_cqe* cqes = nullptr;
+};
+
+// Each request is opened, sized, and then read through the ring so that none
+// of the work blocks the thread calling `ReadFile`
+struct IoUringSpdExecutor::Request {
+  enum Stage {
+    kOpen,
+    kStat,
+    kRead,
+  };
+
+  std::string path;
+  ReadCallback callback;
+  Stage stage = kOpen;
+  int fd = -1;
+  struct statx stat;
+  std::string contents;
+  size_t offset = 0;
+
+  std::string Error() const {
+    return (stage == kOpen ? "Failed to open " : "Failed to read ") + path;
+  }
+};
+
+std::expected<std::unique_ptr<IoUringSpdExecutor>, std::string>
+IoUringSpdExecutor::Create(size_t num_cpu_threads, unsigned queue_depth) {
+  auto ring = std::make_unique<Ring>();
+
+  io_uring_params params = {};
+  ring->fd = IoUringSetup(std::max(queue_depth, 1u), &params);
+  if (ring->fd < 0) {
+    return internal::ErrnoError("io_uring_setup");
+  }
+
+  if (!SupportsOperations(ring->fd)) {
+    return std::unexpected(
+        "The kernel does not support the io_uring operations required");
+  }
+
+  ring->sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->sq_ring_size = ring->cq_ring_size =
+        std::max(ring->sq_ring_size, ring->cq_ring_size);
+  }
+
+  ring->sq_ring = mmap(nullptr, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+  if (ring->sq_ring == MAP_FAILED) {
+    ring->sq_ring = nullptr;
+    return internal::ErrnoError("mmap");
+  }
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->cq_ring = ring->sq_ring;
+  } else {
+    ring->cq_ring =
+        mmap(nullptr, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    if (ring->cq_ring == MAP_FAILED) {
+      ring->cq_ring = nullptr;
+      return internal::ErrnoError("mmap");
+    }
+  }
+
+  ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    return internal::ErrnoError("mmap");
+  }
+  ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+  ring->sq_tail = Offset<unsigned>(ring->sq_ring, params.sq_off.tail);
+  ring->sq_mask = *Offset<unsigned>(ring->sq_ring, params.sq_off.ring_mask);
+  ring->sq_entries = params.sq_entries;
+  ring->sq_array = Offset<unsigned>(ring->sq_ring, params.sq_off.array);
+
+  ring->cq_head = Offset<unsigned>(ring->cq_ring, params.cq_off.head);
+  ring->cq_tail = Offset<unsigned>(ring->cq_ring, params.cq_off.tail);
+  ring->cq_mask = *Offset<unsigned>(ring->cq_ring, params.cq_off.ring_mask);
+  ring->cqes = Offset<io_uring_cqe>(ring->cq_ring, params.cq_off.cqes);
+
+  return std::unique_ptr<IoUringSpdExecutor>(
+      new IoUringSpdExecutor(std::move(ring), num_cpu_threads));
+}
+
+std::unique_ptr<SpdExecutor> CreateSpdExecutor(size_t num_io_threads,
+                                               size_t num_cpu_threads,
+                                               unsigned queue_depth) {
+  std::expected<std::unique_ptr<IoUringSpdExecutor>, std::string> executor =
+      IoUringSpdExecutor::Create(num_cpu_threads, queue_depth);
+  if (!executor) {
+    return std::make_unique<ThreadPoolSpdExecutor>(num_io_threads,
+                                                   num_cpu_threads);
+  }
+
+  return std::move(*executor);
+}
+
+IoUringSpdExecutor::IoUringSpdExecutor(std::unique_ptr<Ring> ring,
+                                       size_t num_cpu_threads)
+    : cpu_pool_(num_cpu_threads),
+      ring_(std::move(ring)),
+      completion_thread_(&IoUringSpdExecutor::Complete, this) {}
+
+IoUringSpdExecutor::~IoUringSpdExecutor() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+
+    // Wake the completion thread with a no-op which it recognizes by its
+    // empty user data. There is always room for it since every other entry
+    // is consumed by the kernel as soon as it is submitted.
+    unsigned tail = *ring_->sq_tail;
+    unsigned index = tail & ring_->sq_mask;
+    std::memset(&ring_->sqes[index], 0, sizeof(io_uring_sqe));
+    ring_->sqes[index].opcode = IORING_OP_NOP;
+    ring_->sq_array[index] = index;
+    std::atomic_ref<unsigned>(*ring_->sq_tail)
+        .store(tail + 1, std::memory_order_release);
+
+    while (IoUringEnter(ring_->fd, 1, 0, 0) < 0 && errno == EINTR) {
+    }
+  }
+
+  completion_thread_.join();
+}
+
+void IoUringSpdExecutor::ReadFile(const std::string& path,
+                                  ReadCallback callback) {
+  auto* request = new Request;
+  request->path = path;
+  request->callback = std::move(callback);
+
+  std::lock_guard lock(mutex_);
+  pending_.push_back(request);
+  SubmitPending();
+}
+
+void IoUringSpdExecutor::Run(std::function<void()> task) {
+  cpu_pool_.Post(std::move(task));
+}
+
+void IoUringSpdExecutor::SubmitPending() {
+  // Reads beyond the size of the submission queue wait in `pending_` so that
+  // the completion queue can never overflow
+  std::vector<Request*> submitted;
+  unsigned tail = *ring_->sq_tail;
+  while (!pending_.empty() && in_flight_ < ring_->sq_entries) {
+    Request* request = pending_.front();
+    pending_.pop_front();
+
+    unsigned index = tail & ring_->sq_mask;
+    io_uring_sqe& sqe = ring_->sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    switch (request->stage) {
+      case Request::kOpen:
+        sqe.opcode = IORING_OP_OPENAT;
+        sqe.fd = AT_FDCWD;
+        sqe.addr = reinterpret_cast<uint64_t>(request->path.c_str());
+        sqe.open_flags = O_RDONLY | O_CLOEXEC;
+        break;
+      case Request::kStat:
+        sqe.opcode = IORING_OP_STATX;
+        sqe.fd = request->fd;
+        sqe.addr = reinterpret_cast<uint64_t>("");
+        sqe.len = STATX_SIZE;
+        sqe.off = reinterpret_cast<uint64_t>(&request->stat);
+        sqe.statx_flags = AT_EMPTY_PATH;
+        break;
+      case Request::kRead:
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = request->fd;
+        sqe.addr = reinterpret_cast<uint64_t>(request->contents.data() +
+                                              request->offset);
+        sqe.len = static_cast<uint32_t>(std::min(
+            kMaxReadSize, request->contents.size() - request->offset));
+        sqe.off = request->offset;
+        break;
+    }
+    sqe.user_data = reinterpret_cast<uint64_t>(request);
+    ring_->sq_array[index] = index;
+
+    tail += 1;
+    in_flight_ += 1;
+    submitted.push_back(request);
+  }
+
+  if (submitted.empty()) {
+    return;
+  }
+
+  std::atomic_ref<unsigned>(*ring_->sq_tail)
+      .store(tail, std::memory_order_release);
+
+  int result;
+  do {
+    result = IoUringEnter(ring_->fd, submitted.size(), 0, 0);
+  } while (result < 0 && errno == EINTR);
+
+  // Entries the kernel did not consume are the most recently added, so they
+  // can be taken back off of the queue and failed
+  size_t consumed = result < 0 ? 0 : static_cast<size_t>(result);
+  if (consumed < submitted.size()) {
+    std::atomic_ref<unsigned>(*ring_->sq_tail)
+        .store(tail - (submitted.size() - consumed),
+               std::memory_order_release);
+
+    for (size_t i = consumed; i < submitted.size(); i++) {
+      Request* request = submitted[i];
+      in_flight_ -= 1;
+      if (request->fd >= 0) {
+        close(request->fd);
+      }
+      cpu_pool_.Post([request]() {
+        request->callback(std::unexpected(request->Error()));
+        delete request;
+      });
+    }
+  }
+}
+
+void IoUringSpdExecutor::Complete() {
+  for (bool done = false; !done;) {
+    if (IoUringEnter(ring_->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+        errno != EINTR) {
+      return;
+    }
+
+    // Completions are reaped with `mutex_` held even though only this thread
+    // consumes them so that the writes made while submitting a request are
+    // visibly ordered before it is touched here
+    std::vector<Request*> finished;
+    {
+      std::lock_guard lock(mutex_);
+
+      unsigned head = *ring_->cq_head;
+      unsigned tail = std::atomic_ref<unsigned>(*ring_->cq_tail)
+                          .load(std::memory_order_acquire);
+      for (; head != tail; head++) {
+        const io_uring_cqe& cqe = ring_->cqes[head & ring_->cq_mask];
+
+        auto* request = reinterpret_cast<Request*>(cqe.user_data);
+        if (request == nullptr) {
+          continue;
+        }
+
+        in_flight_ -= 1;
+
+        if (cqe.res < 0) {
+          request->contents = request->Error();
+          request->offset = std::string::npos;
+          finished.push_back(request);
+        } else if (request->stage == Request::kOpen) {
+          request->fd = cqe.res;
+          request->stage = Request::kStat;
+          pending_.push_front(request);
+        } else if (request->stage == Request::kStat) {
+          if (request->stat.stx_size == 0) {
+            finished.push_back(request);
+          } else {
+            request->contents.resize(request->stat.stx_size);
+            request->stage = Request::kRead;
+            pending_.push_front(request);
+          }
+        } else if (cqe.res == 0) {
+          // The file was truncated after its size was read
+          request->contents.resize(request->offset);
+          finished.push_back(request);
+        } else {
+          request->offset += static_cast<size_t>(cqe.res);
+          if (request->offset < request->contents.size()) {
+            pending_.push_front(request);
+          } else {
+            finished.push_back(request);
+          }
+        }
+      }
+
+      std::atomic_ref<unsigned>(*ring_->cq_head)
+          .store(head, std::memory_order_release);
+
+      SubmitPending();
+
+      done = stopping_ && in_flight_ == 0 && pending_.empty();
+    }
+
+    for (Request* request : finished) {
+      if (request->fd >= 0) {
+        close(request->fd);
+      }
+
+      if (request->offset == std::string::npos) {
+        request->callback(std::unexpected(std::move(request->contents)));
+      } else {
+        request->callback(std::move(request->contents));
+      }
+
+      delete request;
+    }
+  }
+}
+
+}  // namespace libspd
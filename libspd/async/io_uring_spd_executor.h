@@ -0,0 +1,71 @@
+#ifndef _LIBSPD_ASYNC_IO_URING_SPD_EXECUTOR_
+#define _LIBSPD_ASYNC_IO_URING_SPD_EXECUTOR_
+
+#include <cstddef>
+#include <deque>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "libspd/async/spd_executor.h"
+
+namespace libspd {
+
+// An `SpdExecutor` that opens, sizes, and reads files using io_uring, which
+// allows every read to be in flight at once while only a single thread waits
+// for them to complete, so `ReadFile` never blocks on the file system. This is
+// only available on Linux and `Create` returns an error if the kernel does not
+// support io_uring or the operations used here, in which case
+// `ThreadPoolSpdExecutor` should be used instead. `CreateSpdExecutor` makes
+// that choice automatically.
+//
+// Destroying the executor waits for every read that has been started to
+// complete.
+class IoUringSpdExecutor final : public SpdExecutor {
+ public:
+  static std::expected<std::unique_ptr<IoUringSpdExecutor>, std::string>
+  Create(size_t num_cpu_threads, unsigned queue_depth = 64);
+
+  IoUringSpdExecutor(const IoUringSpdExecutor&) = delete;
+  IoUringSpdExecutor& operator=(const IoUringSpdExecutor&) = delete;
+  ~IoUringSpdExecutor();
+
+  void ReadFile(const std::string& path, ReadCallback callback) override;
+  void Run(std::function<void()> task) override;
+
+ private:
+  struct Ring;
+  struct Request;
+
+  IoUringSpdExecutor(std::unique_ptr<Ring> ring, size_t num_cpu_threads);
+
+  // NOTE: Must be called with `mutex_` held
+  void SubmitPending();
+
+  void Complete();
+
+  ThreadPool cpu_pool_;
+  std::unique_ptr<Ring> ring_;
+
+  std::mutex mutex_;
+  std::deque<Request*> pending_;
+  size_t in_flight_ = 0;
+  bool stopping_ = false;
+
+  std::thread completion_thread_;
+};
+
+// Returns an `IoUringSpdExecutor` if the kernel supports it and otherwise a
+// `ThreadPoolSpdExecutor` with `num_io_threads` I/O threads, for instance on
+// Linux 5.1 through 5.5 where io_uring cannot yet open files or probe for the
+// operations it supports.
+std::unique_ptr<SpdExecutor> CreateSpdExecutor(size_t num_io_threads,
+                                               size_t num_cpu_threads,
+                                               unsigned queue_depth = 64);
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_ASYNC_IO_URING_SPD_EXECUTOR_
@@ -0,0 +1,103 @@
+#include "libspd/async/io_uring_spd_executor.h"
+
+#include <future>
+#include <vector>
+
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/temp_directory_test_fixture.h"
+
+namespace libspd {
+namespace {
+
+class IoUringSpdExecutorTest : public TempDirectoryTest {
+ protected:
+  void SetUp() override {
+    TempDirectoryTest::SetUp();
+
+    auto executor = IoUringSpdExecutor::Create(2, 4);
+    if (!executor) {
+      GTEST_SKIP() << executor.error();
+    }
+
+    executor_ = std::move(*executor);
+  }
+
+  std::expected<std::string, std::string> Read(const std::string& path) {
+    std::promise<std::expected<std::string, std::string>> contents;
+    executor_->ReadFile(
+        path, [&contents](std::expected<std::string, std::string> value) {
+          contents.set_value(std::move(value));
+        });
+    return contents.get_future().get();
+  }
+
+  std::unique_ptr<IoUringSpdExecutor> executor_;
+};
+
+TEST_F(IoUringSpdExecutorTest, ReadFile) {
+  std::string path = WriteFile("file.spd", "1.0 2.0\n");
+  EXPECT_EQ("1.0 2.0\n", Read(path));
+}
+
+TEST_F(IoUringSpdExecutorTest, Empty) {
+  std::string path = WriteFile("empty.spd", "");
+  EXPECT_EQ("", Read(path));
+}
+
+TEST_F(IoUringSpdExecutorTest, Missing) {
+  std::string path = Path("missing.spd");
+  EXPECT_EQ("Failed to open " + path, Read(path).error());
+}
+
+TEST_F(IoUringSpdExecutorTest, MoreReadsThanQueueDepth) {
+  constexpr size_t kNumFiles = 64;
+
+  std::vector<std::string> paths;
+  for (size_t i = 0; i < kNumFiles; i++) {
+    paths.push_back(
+        WriteFile(std::to_string(i) + ".spd", std::string(4096 * i + 1, 'a')));
+  }
+
+  std::vector<std::promise<std::expected<std::string, std::string>>> contents(
+      kNumFiles);
+  for (size_t i = 0; i < kNumFiles; i++) {
+    executor_->ReadFile(paths[i], [&contents, i](
+                                      std::expected<std::string, std::string>
+                                          value) {
+      contents[i].set_value(std::move(value));
+    });
+  }
+
+  for (size_t i = 0; i < kNumFiles; i++) {
+    EXPECT_EQ(std::string(4096 * i + 1, 'a'), contents[i].get_future().get());
+  }
+}
+
+TEST_F(IoUringSpdExecutorTest, Run) {
+  std::promise<void> done;
+  executor_->Run([&done]() { done.set_value(); });
+  done.get_future().wait();
+}
+
+using CreateSpdExecutorTest = TempDirectoryTest;
+
+TEST_F(CreateSpdExecutorTest, ReadsFile) {
+  std::string path = WriteFile("file.spd", "1.0 2.0\n");
+
+  std::unique_ptr<SpdExecutor> executor = CreateSpdExecutor(1, 1);
+  if (IoUringSpdExecutor::Create(1)) {
+    EXPECT_NE(nullptr, dynamic_cast<IoUringSpdExecutor*>(executor.get()));
+  } else {
+    EXPECT_NE(nullptr, dynamic_cast<ThreadPoolSpdExecutor*>(executor.get()));
+  }
+
+  std::promise<std::expected<std::string, std::string>> contents;
+  executor->ReadFile(
+      path, [&contents](std::expected<std::string, std::string> value) {
+        contents.set_value(std::move(value));
+      });
+  EXPECT_EQ("1.0 2.0\n", contents.get_future().get());
+}
+
+}  // namespace
+}  // namespace libspd
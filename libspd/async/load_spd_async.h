@@ -0,0 +1,89 @@
+#ifndef _LIBSPD_ASYNC_LOAD_SPD_ASYNC_
+#define _LIBSPD_ASYNC_LOAD_SPD_ASYNC_
+
+#include <concepts>
+#include <coroutine>
+#include <expected>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "libspd/async/spd_executor.h"
+#include "libspd/readers/emissive_spd_reader.h"
+#include "libspd/readers/reflective_spd_reader.h"
+
+namespace libspd {
+
+// An awaitable that reads an SPD file using the I/O of an `SpdExecutor` and
+// then parses it on one of the executor's CPU threads. The awaiting coroutine
+// is resumed on that CPU thread once parsing has finished.
+//
+// NOTE: Behavior is undefined if the executor is destroyed while a load is in
+// progress
+template <std::floating_point Type>
+class [[nodiscard]] SpdLoad {
+ public:
+  using Parser = std::function<std::expected<std::map<Type, Type>, std::string>(
+      std::string_view input)>;
+
+  SpdLoad(std::string path, SpdExecutor& executor, Parser parser)
+      : path_(std::move(path)),
+        executor_(&executor),
+        parser_(std::move(parser)) {}
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    executor_->ReadFile(
+        path_,
+        [this, handle](std::expected<std::string, std::string> contents) {
+          executor_->Run([this, handle, contents = std::move(contents)]() {
+            if (contents) {
+              result_ = parser_(*contents);
+            } else {
+              result_ = std::unexpected(contents.error());
+            }
+
+            handle.resume();
+          });
+        });
+  }
+
+  std::expected<std::map<Type, Type>, std::string> await_resume() {
+    return std::move(result_);
+  }
+
+ private:
+  std::string path_;
+  SpdExecutor* executor_;
+  Parser parser_;
+  std::expected<std::map<Type, Type>, std::string> result_;
+};
+
+// Loads the file at `path` with `co_await`, parsing it with `parser`
+template <std::floating_point Type>
+SpdLoad<Type> LoadSpdAsync(std::string path, SpdExecutor& executor,
+                           typename SpdLoad<Type>::Parser parser) {
+  return SpdLoad<Type>(std::move(path), executor, std::move(parser));
+}
+
+template <std::floating_point Type>
+SpdLoad<Type> LoadEmissiveSpdAsync(std::string path, SpdExecutor& executor) {
+  return LoadSpdAsync<Type>(
+      std::move(path), executor,
+      [](std::string_view input) { return ReadEmissiveSpdFrom<Type>(input); });
+}
+
+template <std::floating_point Type>
+SpdLoad<Type> LoadReflectiveSpdAsync(std::string path, SpdExecutor& executor) {
+  return LoadSpdAsync<Type>(
+      std::move(path), executor, [](std::string_view input) {
+        return ReadReflectiveSpdFrom<Type>(input);
+      });
+}
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_ASYNC_LOAD_SPD_ASYNC_
@@ -0,0 +1,112 @@
+#include "libspd/async/load_spd_async.h"
+
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <vector>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/async/spd_executor.h"
+#include "libspd/temp_directory_test_fixture.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+// A coroutine that starts immediately and destroys itself once it finishes
+struct DetachedTask {
+  struct promise_type {
+    DetachedTask get_return_object() { return DetachedTask(); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+using Result = std::expected<std::map<float, float>, std::string>;
+
+DetachedTask Load(SpdLoad<float> load, std::promise<Result>& result) {
+  result.set_value(co_await load);
+}
+
+using LoadSpdAsyncTest = TempDirectoryTest;
+
+TEST_F(LoadSpdAsyncTest, Emissive) {
+  std::string path = WriteFile("emissive.spd", "1.0 2.0\n3.0 4.0\n");
+
+  ThreadPoolSpdExecutor executor(1, 1);
+  std::promise<Result> result;
+  Load(LoadEmissiveSpdAsync<float>(path, executor), result);
+
+  Result samples = result.get_future().get();
+  ASSERT_TRUE(samples);
+  EXPECT_THAT(*samples, ElementsAre(Pair(1.0f, 2.0f), Pair(3.0f, 4.0f)));
+}
+
+TEST_F(LoadSpdAsyncTest, Reflective) {
+  std::string path = WriteFile("reflective.spd", "1.0 2.0\n");
+
+  ThreadPoolSpdExecutor executor(1, 1);
+  std::promise<Result> result;
+  Load(LoadReflectiveSpdAsync<float>(path, executor), result);
+
+  EXPECT_EQ(
+      "The input contained a sample with a spectral power greater than one",
+      result.get_future().get().error());
+}
+
+TEST_F(LoadSpdAsyncTest, CustomParser) {
+  std::string path = WriteFile("custom.spd", "ignored");
+
+  ThreadPoolSpdExecutor executor(1, 1);
+  std::promise<Result> result;
+  Load(LoadSpdAsync<float>(path, executor,
+                           [](std::string_view input) -> Result {
+                             return std::map<float, float>{
+                                 {1.0f, static_cast<float>(input.size())}};
+                           }),
+       result);
+
+  Result samples = result.get_future().get();
+  ASSERT_TRUE(samples);
+  EXPECT_THAT(*samples, ElementsAre(Pair(1.0f, 7.0f)));
+}
+
+TEST_F(LoadSpdAsyncTest, Missing) {
+  std::string path = Path("missing.spd");
+
+  ThreadPoolSpdExecutor executor(1, 1);
+  std::promise<Result> result;
+  Load(LoadEmissiveSpdAsync<float>(path, executor), result);
+
+  EXPECT_EQ("Failed to open " + path, result.get_future().get().error());
+}
+
+TEST_F(LoadSpdAsyncTest, Many) {
+  constexpr size_t kNumFiles = 64;
+
+  std::vector<std::string> paths;
+  for (size_t i = 0; i < kNumFiles; i++) {
+    paths.push_back(WriteFile(std::to_string(i) + ".spd",
+                              "1.0 " + std::to_string(i) + ".0\n"));
+  }
+
+  ThreadPoolSpdExecutor executor(4, 2);
+  std::vector<std::promise<Result>> results(kNumFiles);
+  for (size_t i = 0; i < kNumFiles; i++) {
+    Load(LoadEmissiveSpdAsync<float>(paths[i], executor), results[i]);
+  }
+
+  for (size_t i = 0; i < kNumFiles; i++) {
+    Result samples = results[i].get_future().get();
+    ASSERT_TRUE(samples);
+    EXPECT_THAT(*samples, ElementsAre(Pair(1.0f, static_cast<float>(i))));
+  }
+}
+
+}  // namespace
+}  // namespace libspd
@@ -0,0 +1,87 @@
+#include "libspd/async/spd_executor.h"
+
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+namespace libspd {
+
+ThreadPool::ThreadPool(size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = 1;
+  }
+
+  threads_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; i++) {
+    threads_.emplace_back(&ThreadPool::Run, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+
+  condition_.notify_all();
+
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Post(std::function<void()> task) {
+  {
+    std::lock_guard lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+
+  condition_.notify_one();
+}
+
+void ThreadPool::Run() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [&] { return stopping_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    task();
+  }
+}
+
+void ThreadPoolSpdExecutor::ReadFile(const std::string& path,
+                                     ReadCallback callback) {
+  io_pool_.Post([path, callback = std::move(callback)]() {
+    callback(ReadFileContents(path));
+  });
+}
+
+void ThreadPoolSpdExecutor::Run(std::function<void()> task) {
+  cpu_pool_.Post(std::move(task));
+}
+
+std::expected<std::string, std::string> ReadFileContents(
+    const std::string& path) {
+  std::ifstream input(path, std::ios::in | std::ios::binary);
+  if (!input) {
+    return std::unexpected("Failed to open " + path);
+  }
+
+  std::string contents(std::istreambuf_iterator<char>(input),
+                       (std::istreambuf_iterator<char>()));
+  if (input.bad()) {
+    return std::unexpected("Failed to read " + path);
+  }
+
+  return contents;
+}
+
+}  // namespace libspd
@@ -0,0 +1,82 @@
+#ifndef _LIBSPD_ASYNC_SPD_EXECUTOR_
+#define _LIBSPD_ASYNC_SPD_EXECUTOR_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <expected>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libspd {
+
+// A fixed set of threads which run the tasks posted to it in order. Tasks that
+// are still queued when the pool is destroyed are run before it returns.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t num_threads);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  void Post(std::function<void()> task);
+
+ private:
+  void Run();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopping_ = false;
+
+  std::vector<std::thread> threads_;
+};
+
+// Provides the file I/O and the CPU threads used by `LoadSpdAsync`. Reading a
+// file and parsing it are kept separate so that a small number of threads can
+// keep many reads in flight without competing with parsing for CPU time.
+class SpdExecutor {
+ public:
+  using ReadCallback =
+      std::function<void(std::expected<std::string, std::string> contents)>;
+
+  virtual ~SpdExecutor() = default;
+
+  // Reads the entire contents of the file at `path` and passes them to
+  // `callback`, which may be invoked on any thread
+  virtual void ReadFile(const std::string& path, ReadCallback callback) = 0;
+
+  // Runs CPU bound work such as parsing
+  virtual void Run(std::function<void()> task) = 0;
+};
+
+// An `SpdExecutor` that performs blocking reads on a dedicated pool of I/O
+// threads. This works on every platform; on Linux `IoUringSpdExecutor` (found
+// in `libspd/async/io_uring_spd_executor.h`) can instead keep every read in
+// flight without an I/O thread per read.
+class ThreadPoolSpdExecutor final : public SpdExecutor {
+ public:
+  ThreadPoolSpdExecutor(size_t num_io_threads, size_t num_cpu_threads)
+      : cpu_pool_(num_cpu_threads), io_pool_(num_io_threads) {}
+
+  void ReadFile(const std::string& path, ReadCallback callback) override;
+  void Run(std::function<void()> task) override;
+
+ private:
+  // Declared so that the I/O pool, which posts work to the CPU pool, is
+  // destroyed first
+  ThreadPool cpu_pool_;
+  ThreadPool io_pool_;
+};
+
+// Reads the entire contents of the file at `path` using blocking I/O
+std::expected<std::string, std::string> ReadFileContents(
+    const std::string& path);
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_ASYNC_SPD_EXECUTOR_
@@ -0,0 +1,79 @@
+#include "libspd/async/spd_executor.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+std::string WriteTemporaryFile(const std::string& name,
+                               const std::string& contents) {
+  std::string path = (std::filesystem::path(::testing::TempDir()) /
+                      ("spd_executor_test_" + std::to_string(getpid()) + "_" +
+                       name))
+                         .string();
+  std::ofstream output(path, std::ios::out | std::ios::binary);
+  output << contents;
+  return path;
+}
+
+TEST(ThreadPool, RunsEveryTask) {
+  std::atomic<int> count = 0;
+  {
+    ThreadPool pool(4);
+    for (int i = 0; i < 1000; i++) {
+      pool.Post([&count]() { count += 1; });
+    }
+  }
+  EXPECT_EQ(1000, count);
+}
+
+TEST(ThreadPool, ZeroThreads) {
+  std::promise<void> done;
+  ThreadPool pool(0);
+  pool.Post([&done]() { done.set_value(); });
+  done.get_future().wait();
+}
+
+TEST(ReadFileContents, Reads) {
+  std::string path = WriteTemporaryFile("reads", std::string("1 2\n\0", 5));
+  EXPECT_EQ(std::string("1 2\n\0", 5), ReadFileContents(path));
+  std::filesystem::remove(path);
+}
+
+TEST(ReadFileContents, Missing) {
+  std::string path = WriteTemporaryFile("missing", "");
+  std::filesystem::remove(path);
+  EXPECT_EQ("Failed to open " + path, ReadFileContents(path).error());
+}
+
+TEST(ThreadPoolSpdExecutor, ReadFile) {
+  std::string path = WriteTemporaryFile("read_file", "1 2\n");
+
+  std::promise<std::expected<std::string, std::string>> contents;
+  ThreadPoolSpdExecutor executor(1, 1);
+  executor.ReadFile(path,
+                    [&contents](std::expected<std::string, std::string> value) {
+                      contents.set_value(std::move(value));
+                    });
+  EXPECT_EQ("1 2\n", contents.get_future().get());
+
+  std::filesystem::remove(path);
+}
+
+TEST(ThreadPoolSpdExecutor, Run) {
+  std::promise<void> done;
+  ThreadPoolSpdExecutor executor(1, 1);
+  executor.Run([&done]() { done.set_value(); });
+  done.get_future().wait();
+}
+
+}  // namespace
+}  // namespace libspd
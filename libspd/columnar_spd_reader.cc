@@ -0,0 +1,215 @@
+#include "libspd/columnar_spd_reader.h"
+
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "libspd/spd_tokenizer.h"
+
+namespace libspd {
+namespace {
+
+std::string_view Trim(std::string_view field) {
+  while (!field.empty() && !internal::IsTokenCharacter(field.front())) {
+    field.remove_prefix(1);
+  }
+
+  while (!field.empty() && !internal::IsTokenCharacter(field.back())) {
+    field.remove_suffix(1);
+  }
+
+  return field;
+}
+
+bool IsQuoted(std::string_view field) {
+  return field.size() >= 2 && field.front() == '"' && field.back() == '"';
+}
+
+// Removes the quotes surrounding a field and replaces each pair of double
+// quotes inside it with a single double quote
+std::string Unquote(std::string_view field) {
+  if (!IsQuoted(field)) {
+    return std::string(field);
+  }
+
+  field.remove_prefix(1);
+  field.remove_suffix(1);
+
+  std::string result;
+  result.reserve(field.size());
+  for (size_t i = 0; i < field.size(); i++) {
+    result.push_back(field[i]);
+    if (field[i] == '"' && i + 1 < field.size() && field[i + 1] == '"') {
+      i += 1;
+    }
+  }
+
+  return result;
+}
+
+// Splits `line` into trimmed fields, reusing the storage of `fields`. As in
+// RFC 4180, a delimiter between double quotes does not end a field and a pair
+// of double quotes inside of them is an escaped double quote, which does not
+// need special handling since it leaves the field quoted.
+std::expected<void, std::string> SplitFields(
+    std::string_view line, char delimiter,
+    std::vector<std::string_view>& fields) {
+  fields.clear();
+
+  size_t start = 0;
+  bool quoted = false;
+  for (size_t i = 0; i <= line.size(); i++) {
+    if (i < line.size() && line[i] == '"') {
+      quoted = !quoted;
+    } else if (i == line.size() || (line[i] == delimiter && !quoted)) {
+      fields.push_back(Trim(line.substr(start, i - start)));
+      start = i + 1;
+    }
+  }
+
+  if (quoted) {
+    return std::unexpected(
+        "The input contained a field with an unterminated quote");
+  }
+
+  return std::expected<void, std::string>();
+}
+
+std::expected<long double, std::string> ParseField(std::string_view field) {
+  if (IsQuoted(field)) {
+    field.remove_prefix(1);
+    field.remove_suffix(1);
+  }
+
+  for (char c : field) {
+    if (!internal::IsTokenCharacter(c)) {
+      return std::unexpected("The input contained an unparsable token");
+    }
+  }
+
+  // A field such as "1,5" must not be read as its numeric prefix
+  size_t length = 0;
+  std::expected<long double, std::string> value =
+      internal::ParseFloat(field, &length);
+  if (value && length != field.size()) {
+    return std::unexpected("The input contained an unparsable token");
+  }
+
+  return value;
+}
+
+}  // namespace
+
+std::expected<void, std::string> ColumnarSpdReader::ReadFrom(
+    std::istream& input) {
+  if (input.fail()) {
+    return std::unexpected("Bad input stream passed");
+  }
+
+  std::string contents(std::istreambuf_iterator<char>(input),
+                       (std::istreambuf_iterator<char>()));
+
+  return ReadFrom(std::string_view(contents));
+}
+
+std::expected<void, std::string> ColumnarSpdReader::ReadFrom(
+    std::string_view input) {
+  auto [text, line_ending] = internal::ReadFirstLine(input);
+
+  size_t header_rows = 0;
+  std::optional<size_t> num_columns;
+  std::vector<std::string_view> fields;
+  for (;;) {
+    if (!Trim(text).empty()) {
+      if (std::expected<void, std::string> result =
+              SplitFields(text, format_.delimiter, fields);
+          !result) {
+        return result;
+      }
+
+      if (header_rows < format_.header_rows) {
+        header_rows += 1;
+        if (header_rows == format_.header_rows) {
+          std::vector<std::string> names;
+          for (size_t column = 1; column < fields.size(); column++) {
+            names.push_back(Unquote(fields[column]));
+          }
+
+          num_columns = names.size();
+          std::vector<std::string_view> name_views(names.begin(),
+                                                   names.end());
+          if (std::expected<void, std::string> result =
+                  HandleColumns(name_views);
+              !result) {
+            return result;
+          }
+        }
+      } else {
+        if (!num_columns) {
+          num_columns = fields.size() - 1;
+          std::vector<std::string_view> names(*num_columns);
+          if (std::expected<void, std::string> result = HandleColumns(names);
+              !result) {
+            return result;
+          }
+        }
+
+        if (fields.size() - 1 > *num_columns) {
+          return std::unexpected(
+              "The input contained a row with more fields than there are "
+              "columns");
+        }
+
+        if (fields[0].empty()) {
+          return std::unexpected(
+              "The input contained a row with no wavelength");
+        }
+
+        std::expected<long double, std::string> wavelength =
+            ParseField(fields[0]);
+        if (!wavelength) {
+          return std::unexpected(std::move(wavelength.error()));
+        }
+
+        for (size_t column = 1; column < fields.size(); column++) {
+          if (fields[column].empty()) {
+            continue;
+          }
+
+          std::expected<long double, std::string> spectral_power =
+              ParseField(fields[column]);
+          if (!spectral_power) {
+            return std::unexpected(std::move(spectral_power.error()));
+          }
+
+          if (std::expected<void, std::string> result =
+                  HandleSample(column - 1, *wavelength, *spectral_power);
+              !result) {
+            return result;
+          }
+        }
+      }
+    }
+
+    if (input.empty()) {
+      break;
+    }
+
+    std::expected<std::string_view, std::string> next_line =
+        internal::ReadNextLine(input, line_ending);
+    if (!next_line) {
+      return std::unexpected(std::move(next_line.error()));
+    }
+
+    text = *next_line;
+  }
+
+  if (!num_columns) {
+    return HandleColumns(std::span<const std::string_view>());
+  }
+
+  return std::expected<void, std::string>();
+}
+
+}  // namespace libspd
@@ -0,0 +1,68 @@
+#ifndef _LIBSPD_COLUMNAR_SPD_READER_
+#define _LIBSPD_COLUMNAR_SPD_READER_
+
+#include <cstddef>
+#include <expected>
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace libspd {
+
+// Describes the layout of a delimited file such as a CSV or TSV file.
+struct ColumnarFormat {
+  // The character separating the fields of each row (for instance, ',' or
+  // '\t')
+  char delimiter = ',';
+
+  // The number of rows at the start of the file that do not contain samples.
+  // The last of these rows, if any, holds the name of each column.
+  size_t header_rows = 1;
+};
+
+// The base class for reading delimited files which hold many spectra side by
+// side. The first column of each row holds a wavelength and every other column
+// holds the spectral power of one spectrum at that wavelength. Rows are split
+// into lines using the same rules as `SpdReader` and numbers are parsed with
+// the same conversion, at the maximum precision possible.
+//
+// Whitespace surrounding a field is ignored, as are rows that are entirely
+// whitespace. As in RFC 4180, a field may be enclosed in double quotes, in
+// which case it may contain the delimiter and a pair of double quotes stands
+// for a single double quote; however, a field may not span more than one line.
+// A row may omit trailing fields or leave a field empty, in which case the
+// corresponding spectrum has no sample at that wavelength.
+//
+// Like `SpdReader`, this class performs very minimal validation and it is
+// recommended that most clients instead use the readers under
+// `libspd/readers`.
+class ColumnarSpdReader {
+ public:
+  explicit ColumnarSpdReader(ColumnarFormat format = ColumnarFormat())
+      : format_(format) {}
+
+  // NOTE: Behavior is undefined if input is not a binary stream
+  std::expected<void, std::string> ReadFrom(std::istream& input);
+
+  std::expected<void, std::string> ReadFrom(std::string_view input);
+
+ protected:
+  // Called once before any samples with the name of each spectrum column. If
+  // the format has no header rows, the names are empty and the number of
+  // spectrum columns is taken from the first row. The names are only valid
+  // for the duration of the call.
+  virtual std::expected<void, std::string> HandleColumns(
+      std::span<const std::string_view> names) = 0;
+
+  // NOTE: `column` counts from zero starting at the first spectrum column
+  virtual std::expected<void, std::string> HandleSample(
+      size_t column, long double wavelength, long double spectral_power) = 0;
+
+ private:
+  ColumnarFormat format_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_COLUMNAR_SPD_READER_
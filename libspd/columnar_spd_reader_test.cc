@@ -0,0 +1,249 @@
+#include "libspd/columnar_spd_reader.h"
+
+#include <sstream>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::InSequence;
+using ::testing::IsEmpty;
+using ::testing::Return;
+
+class MockColumnarSpdReader final : public ColumnarSpdReader {
+ public:
+  using ColumnarSpdReader::ColumnarSpdReader;
+
+  MOCK_METHOD((std::expected<void, std::string>), HandleColumns,
+              (std::span<const std::string_view>), (override));
+  MOCK_METHOD((std::expected<void, std::string>), HandleSample,
+              (size_t, long double, long double), (override));
+};
+
+TEST(ColumnarSpdReader, BadStream) {
+  std::stringstream input;
+  input.setstate(std::ios::failbit);
+
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(_)).Times(0);
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("Bad input stream passed", reader.ReadFrom(input).error());
+}
+
+TEST(ColumnarSpdReader, Empty) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(IsEmpty()))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_TRUE(reader.ReadFrom(std::string_view("")));
+}
+
+TEST(ColumnarSpdReader, Csv) {
+  std::string_view input =
+      "wavelength, \"first\" ,second\n"
+      "1.0,2.0,3.0\n"
+      "4.0, 5.0 ,6.0\n";
+
+  MockColumnarSpdReader reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(reader, HandleColumns(ElementsAre("first", "second")))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(1, 1.0, 3.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 4.0, 5.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(1, 4.0, 6.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(reader.ReadFrom(input));
+}
+
+TEST(ColumnarSpdReader, QuotedFields) {
+  std::string_view input =
+      "nm,\"Sample, A\", \"Say \"\"hi\"\"\"\n"
+      "\"1.0\",2.0,\"3.0\"\n";
+
+  MockColumnarSpdReader reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(reader, HandleColumns(ElementsAre("Sample, A", "Say \"hi\"")))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(1, 1.0, 3.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(reader.ReadFrom(input));
+}
+
+TEST(ColumnarSpdReader, UnterminatedQuote) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(_)).Times(0);
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("The input contained a field with an unterminated quote",
+            reader.ReadFrom(std::string_view("nm,\"a,b\n1.0,2.0\n")).error());
+}
+
+TEST(ColumnarSpdReader, TsvFromStream) {
+  std::stringstream input("nm\ta\tb\r\n1.0\t2.0\t3.0\r\n");
+
+  MockColumnarSpdReader reader(ColumnarFormat{.delimiter = '\t'});
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(reader, HandleColumns(ElementsAre("a", "b")))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(1, 1.0, 3.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(reader.ReadFrom(input));
+}
+
+TEST(ColumnarSpdReader, NoHeader) {
+  MockColumnarSpdReader reader(ColumnarFormat{.header_rows = 0});
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(reader, HandleColumns(ElementsAre("", "")))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(1, 1.0, 3.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(reader.ReadFrom(std::string_view("1.0,2.0,3.0")));
+}
+
+TEST(ColumnarSpdReader, MultipleHeaderRows) {
+  std::string_view input =
+      "Vendor export, version 2\n"
+      "\n"
+      "nm,a\n"
+      "1.0,2.0\n";
+
+  MockColumnarSpdReader reader(ColumnarFormat{.header_rows = 2});
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(reader.ReadFrom(input));
+}
+
+TEST(ColumnarSpdReader, MissingFields) {
+  std::string_view input =
+      "nm,a,b\n"
+      "1.0,,3.0\n"
+      "4.0,5.0\n";
+
+  MockColumnarSpdReader reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(reader, HandleColumns(ElementsAre("a", "b")))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(1, 1.0, 3.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(reader, HandleSample(0, 4.0, 5.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(reader.ReadFrom(input));
+}
+
+TEST(ColumnarSpdReader, TooManyFields) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ(
+      "The input contained a row with more fields than there are columns",
+      reader.ReadFrom(std::string_view("nm,a\n1.0,2.0,3.0")).error());
+}
+
+TEST(ColumnarSpdReader, NoWavelength) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("The input contained a row with no wavelength",
+            reader.ReadFrom(std::string_view("nm,a\n,2.0")).error());
+}
+
+TEST(ColumnarSpdReader, UnparsableField) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("The input contained an unparsable token",
+            reader.ReadFrom(std::string_view("nm,a\n1.0,2.0 3.0")).error());
+}
+
+TEST(ColumnarSpdReader, PartiallyNumericField) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("The input contained an unparsable token",
+            reader.ReadFrom(std::string_view("nm,a\n400,1nm\n")).error());
+}
+
+TEST(ColumnarSpdReader, DecimalCommaField) {
+  MockColumnarSpdReader reader(ColumnarFormat{.delimiter = ';'});
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("The input contained an unparsable token",
+            reader.ReadFrom(std::string_view("nm;a\n400;1,5\n")).error());
+}
+
+TEST(ColumnarSpdReader, MismatchedLineEndings) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  EXPECT_EQ("The input contained mismatched line endings",
+            reader.ReadFrom(std::string_view("nm,a\n\r1.0,2.0")).error());
+}
+
+TEST(ColumnarSpdReader, ReturnsColumnsError) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::unexpected("error")));
+  EXPECT_CALL(reader, HandleSample(_, _, _)).Times(0);
+  std::string_view input = "nm,a\n1.0,2.0";
+  EXPECT_EQ("error", reader.ReadFrom(input).error());
+}
+
+TEST(ColumnarSpdReader, ReturnsSampleError) {
+  MockColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleColumns(ElementsAre("a")))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(0, 1.0, 2.0))
+      .WillOnce(Return(std::unexpected("error")));
+  EXPECT_EQ("error",
+            reader.ReadFrom(std::string_view("nm,a\n1.0,2.0\n3.0,4.0"))
+                .error());
+}
+
+}  // namespace
+}  // namespace libspd
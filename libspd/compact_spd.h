@@ -0,0 +1,175 @@
+#ifndef _LIBSPD_COMPACT_SPD_
+#define _LIBSPD_COMPACT_SPD_
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace libspd {
+
+// A read-only copy of the samples from an SPD file stored in flat arrays.
+// Samples which lie on a uniform grid are stored as a starting wavelength,
+// a step, and an array of spectral powers so that only the spectral powers
+// take up space and looking up a wavelength is a matter of arithmetic. All
+// other samples are stored as parallel arrays of wavelengths and spectral
+// powers.
+//
+// Samples are only treated as lying on a uniform grid if every wavelength can
+// be reproduced exactly as `start + index * step`, so no precision is lost
+// either way.
+template <std::floating_point Type>
+class CompactSpd {
+ public:
+  CompactSpd() = default;
+
+  // If `uniformly_spaced` is false, the samples are stored explicitly without
+  // checking whether they lie on a uniform grid. This is useful for skipping
+  // that check when statistics computed while parsing already rule it out.
+  explicit CompactSpd(const std::map<Type, Type>& samples,
+                      bool uniformly_spaced = true) {
+    spectral_powers_.reserve(samples.size());
+    for (const auto& [wavelength, spectral_power] : samples) {
+      spectral_powers_.push_back(spectral_power);
+    }
+
+    if (!samples.empty()) {
+      start_ = samples.begin()->first;
+    }
+
+    if (samples.size() >= 2) {
+      step_ = std::next(samples.begin())->first - start_;
+    }
+
+    if (uniformly_spaced) {
+      size_t index = 0;
+      for (const auto& [wavelength, spectral_power] : samples) {
+        if (UniformWavelength(index++) != wavelength) {
+          uniformly_spaced = false;
+          break;
+        }
+      }
+    }
+
+    if (!uniformly_spaced) {
+      wavelengths_.reserve(samples.size());
+      for (const auto& [wavelength, spectral_power] : samples) {
+        wavelengths_.push_back(wavelength);
+      }
+    }
+  }
+
+  // Stores samples lying on the grid `start + index * step` without storing
+  // their wavelengths.
+  //
+  // NOTE: Behavior is undefined if spectral_powers contains more than one
+  //       sample and step is not positive
+  CompactSpd(Type start, Type step, std::vector<Type> spectral_powers)
+      : start_(start),
+        step_(step),
+        spectral_powers_(std::move(spectral_powers)) {}
+
+  // If `uniformly_spaced` is false, the samples are stored explicitly without
+  // checking whether they lie on a uniform grid.
+  //
+  // NOTE: Behavior is undefined if wavelengths is not strictly increasing or
+  //       is not the same size as spectral_powers
+  CompactSpd(std::vector<Type> wavelengths, std::vector<Type> spectral_powers,
+             bool uniformly_spaced = true)
+      : wavelengths_(std::move(wavelengths)),
+        spectral_powers_(std::move(spectral_powers)) {
+    if (!wavelengths_.empty()) {
+      start_ = wavelengths_.front();
+    }
+
+    if (wavelengths_.size() >= 2) {
+      step_ = wavelengths_[1] - start_;
+    }
+
+    if (uniformly_spaced) {
+      for (size_t index = 0; index < wavelengths_.size(); index++) {
+        if (UniformWavelength(index) != wavelengths_[index]) {
+          uniformly_spaced = false;
+          break;
+        }
+      }
+    }
+
+    if (uniformly_spaced) {
+      wavelengths_.clear();
+      wavelengths_.shrink_to_fit();
+    }
+  }
+
+  bool empty() const { return spectral_powers_.empty(); }
+  size_t size() const { return spectral_powers_.size(); }
+
+  // Returns true if the samples are stored on a uniform grid
+  bool uniform() const { return wavelengths_.empty(); }
+
+  // NOTE: Behavior is undefined if index >= size()
+  Type wavelength(size_t index) const {
+    if (uniform()) {
+      return UniformWavelength(index);
+    }
+
+    return wavelengths_[index];
+  }
+
+  // NOTE: Behavior is undefined if index >= size()
+  Type spectral_power(size_t index) const { return spectral_powers_[index]; }
+
+  // Returns the spectral power sampled at exactly `wavelength` if there is one
+  std::optional<Type> Find(Type wavelength) const {
+    if (empty()) {
+      return std::nullopt;
+    }
+
+    size_t index;
+    if (uniform()) {
+      if (size() == 1) {
+        index = 0;
+      } else {
+        Type offset = (wavelength - start_) / step_;
+        if (!(offset >= static_cast<Type>(0.0)) ||
+            !(offset < static_cast<Type>(size()))) {
+          return std::nullopt;
+        }
+
+        index = std::min(static_cast<size_t>(offset + static_cast<Type>(0.5)),
+                         size() - 1);
+      }
+    } else {
+      index = std::lower_bound(wavelengths_.begin(), wavelengths_.end(),
+                               wavelength) -
+              wavelengths_.begin();
+      if (index == size()) {
+        return std::nullopt;
+      }
+    }
+
+    if (this->wavelength(index) != wavelength) {
+      return std::nullopt;
+    }
+
+    return spectral_powers_[index];
+  }
+
+ private:
+  Type UniformWavelength(size_t index) const {
+    return start_ + static_cast<Type>(index) * step_;
+  }
+
+  Type start_ = 0.0;
+  Type step_ = 0.0;
+  std::vector<Type> wavelengths_;
+  std::vector<Type> spectral_powers_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_COMPACT_SPD_
@@ -0,0 +1,118 @@
+#include "libspd/compact_spd.h"
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+TEST(CompactSpd, Empty) {
+  CompactSpd<float> spd;
+  EXPECT_TRUE(spd.empty());
+  EXPECT_EQ(0u, spd.size());
+  EXPECT_EQ(std::nullopt, spd.Find(1.0));
+}
+
+TEST(CompactSpd, SingleSample) {
+  CompactSpd<float> spd(std::map<float, float>({{2.0, 3.0}}));
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(1u, spd.size());
+  EXPECT_EQ(2.0, spd.wavelength(0));
+  EXPECT_EQ(3.0, spd.spectral_power(0));
+  EXPECT_EQ(3.0, spd.Find(2.0));
+  EXPECT_EQ(std::nullopt, spd.Find(1.0));
+}
+
+TEST(CompactSpd, Uniform) {
+  std::map<float, float> samples;
+  for (int i = 0; i <= 80; i++) {
+    samples[380.0f + 5.0f * i] = static_cast<float>(i);
+  }
+
+  CompactSpd<float> spd(samples);
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(samples.size(), spd.size());
+
+  size_t index = 0;
+  for (const auto& [wavelength, spectral_power] : samples) {
+    EXPECT_EQ(wavelength, spd.wavelength(index));
+    EXPECT_EQ(spectral_power, spd.spectral_power(index));
+    EXPECT_EQ(spectral_power, spd.Find(wavelength));
+    index += 1;
+  }
+
+  EXPECT_EQ(std::nullopt, spd.Find(375.0));
+  EXPECT_EQ(std::nullopt, spd.Find(382.5));
+  EXPECT_EQ(std::nullopt, spd.Find(785.0));
+}
+
+TEST(CompactSpd, NonUniform) {
+  std::map<float, float> samples = {{1.0, 2.0}, {2.0, 3.0}, {4.0, 5.0}};
+
+  CompactSpd<float> spd(samples);
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(4.0, spd.wavelength(2));
+  EXPECT_EQ(5.0, spd.spectral_power(2));
+  EXPECT_EQ(3.0, spd.Find(2.0));
+  EXPECT_EQ(std::nullopt, spd.Find(3.0));
+  EXPECT_EQ(std::nullopt, spd.Find(5.0));
+}
+
+TEST(CompactSpd, InexactGridIsExplicit) {
+  std::map<float, float> samples = {
+      {400.1f, 1.0}, {400.2f, 2.0}, {400.3f, 3.0}};
+
+  CompactSpd<float> spd(samples);
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(400.3f, spd.wavelength(2));
+  EXPECT_EQ(3.0, spd.Find(400.3f));
+}
+
+TEST(CompactSpd, NotUniformlySpaced) {
+  std::map<float, float> samples = {{1.0, 2.0}, {2.0, 3.0}};
+
+  CompactSpd<float> spd(samples, false);
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(2.0, spd.wavelength(1));
+  EXPECT_EQ(3.0, spd.Find(2.0));
+}
+
+TEST(CompactSpd, Grid) {
+  CompactSpd<float> spd(380.0f, 5.0f, std::vector<float>({1.0, 2.0, 3.0}));
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(390.0, spd.wavelength(2));
+  EXPECT_EQ(3.0, spd.spectral_power(2));
+  EXPECT_EQ(2.0, spd.Find(385.0));
+  EXPECT_EQ(std::nullopt, spd.Find(387.0));
+}
+
+TEST(CompactSpd, ArraysOnGrid) {
+  CompactSpd<float> spd(std::vector<float>({1.0, 3.0, 5.0}),
+                        std::vector<float>({2.0, 4.0, 6.0}));
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(5.0, spd.wavelength(2));
+  EXPECT_EQ(4.0, spd.Find(3.0));
+}
+
+TEST(CompactSpd, ArraysNotOnGrid) {
+  CompactSpd<float> spd(std::vector<float>({1.0, 2.0, 4.0}),
+                        std::vector<float>({2.0, 3.0, 5.0}));
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(4.0, spd.wavelength(2));
+  EXPECT_EQ(5.0, spd.Find(4.0));
+  EXPECT_EQ(std::nullopt, spd.Find(3.0));
+}
+
+TEST(CompactSpd, ArraysNotUniformlySpaced) {
+  CompactSpd<float> spd(std::vector<float>({1.0, 2.0}),
+                        std::vector<float>({2.0, 3.0}), false);
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(2.0, spd.wavelength(1));
+  EXPECT_EQ(3.0, spd.Find(2.0));
+}
+
+}  // namespace
+}  // namespace libspd
@@ -0,0 +1,24 @@
+#ifndef _LIBSPD_ERRNO_ERROR_
+#define _LIBSPD_ERRNO_ERROR_
+
+#include <cerrno>
+#include <cstring>
+#include <expected>
+#include <string>
+#include <string_view>
+
+namespace libspd {
+namespace internal {
+
+// Returns an error naming the system call `operation` that failed along with
+// the description of `error`, which defaults to the current value of `errno`
+inline std::unexpected<std::string> ErrnoError(std::string_view operation,
+                                               int error = errno) {
+  return std::unexpected(std::string(operation) + " failed: " +
+                         std::strerror(error));
+}
+
+}  // namespace internal
+}  // namespace libspd
+
+#endif  // _LIBSPD_ERRNO_ERROR_
@@ -0,0 +1,26 @@
+#include "libspd/errno_error.h"
+
+#include <cerrno>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace internal {
+namespace {
+
+TEST(ErrnoError, UsesErrno) {
+  errno = ENOENT;
+  EXPECT_EQ("open failed: " + std::string(std::strerror(ENOENT)),
+            ErrnoError("open").error());
+}
+
+TEST(ErrnoError, UsesError) {
+  errno = ENOENT;
+  EXPECT_EQ("mmap failed: " + std::string(std::strerror(ENOMEM)),
+            ErrnoError("mmap", ENOMEM).error());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace libspd
@@ -0,0 +1,79 @@
+#ifndef _LIBSPD_FIXED_CAPACITY_SPD_
+#define _LIBSPD_FIXED_CAPACITY_SPD_
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace libspd {
+
+// An ordered collection of samples from an SPD file which is stored inline and
+// never allocates. Samples are kept sorted by wavelength and each wavelength
+// may appear at most once.
+template <std::floating_point Type, size_t Capacity>
+class FixedCapacitySpd {
+ public:
+  using value_type = std::pair<Type, Type>;
+  using const_iterator = const value_type*;
+
+  constexpr const_iterator begin() const { return samples_.data(); }
+  constexpr const_iterator end() const { return samples_.data() + size_; }
+
+  constexpr bool empty() const { return size_ == 0; }
+  constexpr size_t size() const { return size_; }
+  static constexpr size_t capacity() { return Capacity; }
+
+  constexpr const value_type& operator[](size_t index) const {
+    return samples_[index];
+  }
+
+  constexpr void clear() { size_ = 0; }
+
+  // Inserts a sample at its sorted position if no sample with the same
+  // wavelength exists. Returns the sample with the same wavelength along with
+  // whether the insertion took place. If the wavelength is not present and
+  // the collection is full, returns end() and false.
+  constexpr std::pair<const_iterator, bool> try_emplace(Type wavelength,
+                                                        Type spectral_power) {
+    value_type* first = samples_.data();
+    value_type* last = samples_.data() + size_;
+
+    value_type* position = last;
+    if (size_ != 0 && !((last - 1)->first < wavelength)) {
+      position = std::lower_bound(
+          first, last, wavelength,
+          [](const value_type& sample, Type wavelength) {
+            return sample.first < wavelength;
+          });
+    }
+
+    if (position != last && position->first == wavelength) {
+      return std::make_pair(position, false);
+    }
+
+    if (size_ == Capacity) {
+      return std::make_pair(end(), false);
+    }
+
+    std::move_backward(position, last, last + 1);
+    *position = value_type(wavelength, spectral_power);
+    size_ += 1;
+
+    return std::make_pair(position, true);
+  }
+
+  friend constexpr bool operator==(const FixedCapacitySpd& lhs,
+                                   const FixedCapacitySpd& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+ private:
+  std::array<value_type, Capacity> samples_ = {};
+  size_t size_ = 0;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_FIXED_CAPACITY_SPD_
@@ -0,0 +1,76 @@
+#include "libspd/fixed_capacity_spd.h"
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+
+TEST(FixedCapacitySpd, Empty) {
+  FixedCapacitySpd<float, 4> spd;
+  EXPECT_TRUE(spd.empty());
+  EXPECT_EQ(0u, spd.size());
+  EXPECT_EQ(4u, spd.capacity());
+  EXPECT_THAT(spd, IsEmpty());
+}
+
+TEST(FixedCapacitySpd, InsertsInOrder) {
+  FixedCapacitySpd<float, 4> spd;
+  EXPECT_TRUE(spd.try_emplace(3.0, 4.0).second);
+  EXPECT_TRUE(spd.try_emplace(1.0, 2.0).second);
+  EXPECT_TRUE(spd.try_emplace(5.0, 6.0).second);
+  EXPECT_TRUE(spd.try_emplace(2.0, 3.0).second);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(2.0, 3.0), Pair(3.0, 4.0),
+                               Pair(5.0, 6.0)));
+  EXPECT_EQ(2.0, spd[1].first);
+}
+
+TEST(FixedCapacitySpd, Duplicate) {
+  FixedCapacitySpd<float, 4> spd;
+  EXPECT_TRUE(spd.try_emplace(1.0, 2.0).second);
+
+  auto [iter, inserted] = spd.try_emplace(1.0, 3.0);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(spd.begin(), iter);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0)));
+}
+
+TEST(FixedCapacitySpd, Full) {
+  FixedCapacitySpd<float, 2> spd;
+  EXPECT_TRUE(spd.try_emplace(1.0, 2.0).second);
+  EXPECT_TRUE(spd.try_emplace(3.0, 4.0).second);
+
+  auto [iter, inserted] = spd.try_emplace(2.0, 3.0);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(spd.end(), iter);
+
+  std::tie(iter, inserted) = spd.try_emplace(3.0, 5.0);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(spd.begin() + 1, iter);
+}
+
+TEST(FixedCapacitySpd, Clear) {
+  FixedCapacitySpd<float, 2> spd;
+  EXPECT_TRUE(spd.try_emplace(1.0, 2.0).second);
+  spd.clear();
+  EXPECT_THAT(spd, IsEmpty());
+}
+
+TEST(FixedCapacitySpd, Equality) {
+  FixedCapacitySpd<float, 2> spd0;
+  FixedCapacitySpd<float, 2> spd1;
+  EXPECT_EQ(spd0, spd1);
+
+  spd0.try_emplace(1.0, 2.0);
+  EXPECT_NE(spd0, spd1);
+
+  spd1.try_emplace(1.0, 2.0);
+  EXPECT_EQ(spd0, spd1);
+}
+
+}  // namespace
+}  // namespace libspd
@@ -0,0 +1,29 @@
+#include "libspd/readers/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace libspd {
+namespace {
+
+std::atomic<size_t> num_allocations = 0;
+
+}  // namespace
+
+size_t NumAllocations() { return num_allocations.load(); }
+
+}  // namespace libspd
+
+void* operator new(size_t size) {
+  libspd::num_allocations += 1;
+  if (void* result = std::malloc(size)) {
+    return result;
+  }
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t size) noexcept { std::free(ptr); }
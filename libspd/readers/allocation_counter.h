@@ -0,0 +1,15 @@
+#ifndef _LIBSPD_READERS_ALLOCATION_COUNTER_
+#define _LIBSPD_READERS_ALLOCATION_COUNTER_
+
+#include <cstddef>
+
+namespace libspd {
+
+// Returns the number of calls made to the global `operator new` so far. The
+// global allocation functions are replaced in their own translation unit so
+// that the compiler never sees them paired with allocations made elsewhere.
+size_t NumAllocations();
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_ALLOCATION_COUNTER_
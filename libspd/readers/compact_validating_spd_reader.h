@@ -0,0 +1,110 @@
+#ifndef _LIBSPD_READERS_COMPACT_VALIDATING_SPD_READER_
+#define _LIBSPD_READERS_COMPACT_VALIDATING_SPD_READER_
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libspd/compact_spd.h"
+#include "libspd/readers/validating_spd_reader.h"
+#include "libspd/spd_reader.h"
+
+namespace libspd {
+
+// A variant of `ValidatingSpdReader` that builds a `CompactSpd` directly
+// instead of a `std::map`. While the samples arrive in increasing order on the
+// grid formed by the first two wavelengths only their spectral powers are
+// stored. Once the grid breaks or a sample arrives out of order the wavelengths
+// are stored explicitly, and if the samples arrived out of order `Reset`
+// checks whether they form a grid once sorted.
+template <std::floating_point Type>
+class CompactValidatingSpdReader : public SpdReader {
+ private:
+  Type start_ = 0.0;
+  Type step_ = 0.0;
+  std::vector<Type> wavelengths_;
+  std::vector<Type> spectral_powers_;
+  bool in_order_ = true;
+
+ public:
+  CompactSpd<Type> Reset() {
+    CompactSpd<Type> result =
+        wavelengths_.empty()
+            ? CompactSpd<Type>(start_, step_, std::move(spectral_powers_))
+            : CompactSpd<Type>(std::move(wavelengths_),
+                               std::move(spectral_powers_), !in_order_);
+    start_ = 0.0;
+    step_ = 0.0;
+    wavelengths_.clear();
+    spectral_powers_.clear();
+    in_order_ = true;
+    return result;
+  }
+
+ protected:
+  virtual std::expected<void, std::string> HandleSample(
+      const std::pair<Type, Type>& sample) = 0;
+
+  std::expected<void, std::string> HandleSample(
+      long double wavelength, long double spectral_power) final override {
+    std::expected<std::pair<Type, Type>, std::string> sample =
+        ValidateSample<Type>(wavelength, spectral_power);
+    if (!sample) {
+      return std::unexpected(std::move(sample.error()));
+    }
+
+    if (wavelengths_.empty()) {
+      size_t size = spectral_powers_.size();
+      if (size == 0) {
+        start_ = sample->first;
+      } else if (size == 1) {
+        step_ = sample->first - start_;
+      }
+
+      if (size == 0 || (UniformWavelength(size - 1) < sample->first &&
+                        UniformWavelength(size) == sample->first)) {
+        spectral_powers_.push_back(sample->second);
+        return HandleSample(*sample);
+      }
+
+      wavelengths_.reserve(spectral_powers_.capacity());
+      for (size_t index = 0; index < size; index++) {
+        wavelengths_.push_back(UniformWavelength(index));
+      }
+    }
+
+    if (wavelengths_.back() < sample->first) {
+      wavelengths_.push_back(sample->first);
+      spectral_powers_.push_back(sample->second);
+      return HandleSample(*sample);
+    }
+
+    auto iter = std::lower_bound(wavelengths_.begin(), wavelengths_.end(),
+                                 sample->first);
+    if (*iter == sample->first) {
+      return std::unexpected(
+          "The input contained multiple samples with the same wavelength");
+    }
+
+    spectral_powers_.insert(
+        spectral_powers_.begin() + (iter - wavelengths_.begin()),
+        sample->second);
+    wavelengths_.insert(iter, sample->first);
+    in_order_ = false;
+
+    return HandleSample(*sample);
+  }
+
+ private:
+  Type UniformWavelength(size_t index) const {
+    return start_ + static_cast<Type>(index) * step_;
+  }
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_COMPACT_VALIDATING_SPD_READER_
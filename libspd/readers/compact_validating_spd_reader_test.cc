@@ -0,0 +1,184 @@
+#include "libspd/readers/compact_validating_spd_reader.h"
+
+#include <fstream>
+#include <iterator>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/readers/allocation_counter.h"
+#include "tools/cpp/runfiles/runfiles.h"
+
+namespace libspd {
+namespace {
+
+using ::bazel::tools::cpp::runfiles::Runfiles;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Pair;
+using ::testing::Return;
+
+class MockCompactValidatingSpdReader final
+    : public CompactValidatingSpdReader<float> {
+ public:
+  MOCK_METHOD((std::expected<void, std::string>), HandleComment,
+              (std::string_view), (override));
+  MOCK_METHOD((std::expected<void, std::string>), HandleSample,
+              ((const std::pair<float, float>)&), (override));
+};
+
+class TestSpdReader final : public CompactValidatingSpdReader<float> {
+ protected:
+  std::expected<void, std::string> HandleComment(
+      std::string_view comment) override {
+    return std::expected<void, std::string>();
+  }
+
+  std::expected<void, std::string> HandleSample(
+      const std::pair<float, float>& sample) override {
+    return std::expected<void, std::string>();
+  }
+};
+
+std::string ReadRunfile(const std::string& filename) {
+  std::unique_ptr<Runfiles> runfiles(Runfiles::CreateForTest());
+  std::string path = "__main__/libspd/readers/test_data/" + filename;
+  std::ifstream input(runfiles->Rlocation(path),
+                      std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(input),
+                     std::istreambuf_iterator<char>());
+}
+
+CompactSpd<float> Read(std::string_view input) {
+  TestSpdReader spd_reader;
+  EXPECT_TRUE(spd_reader.ReadFrom(input));
+  return spd_reader.Reset();
+}
+
+TEST(CompactValidatingSpdReader, Nothing) {
+  MockCompactValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_)).Times(0);
+  EXPECT_TRUE(spd_reader.Reset().empty());
+}
+
+TEST(CompactValidatingSpdReader, ReturnsSampleError) {
+  std::string input = ReadRunfile("well_formed.spd");
+
+  MockCompactValidatingSpdReader spd_reader;
+
+  EXPECT_CALL(spd_reader, HandleComment("Comment"))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(spd_reader, HandleSample(Pair(1.0, 2.0)))
+      .WillOnce(Return(std::unexpected("error")));
+
+  EXPECT_EQ("error", spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(CompactValidatingSpdReader, WellFormed) {
+  std::string input = ReadRunfile("well_formed.spd");
+
+  MockCompactValidatingSpdReader spd_reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(spd_reader, HandleComment("Comment"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(Pair(1.0, 2.0)))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(Pair(5.0, 6.0)))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(Pair(3.0, 4.0)))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(spd_reader.ReadFrom(std::string_view(input)));
+
+  // The samples arrive out of order but still lie on a grid once sorted
+  CompactSpd<float> spd = spd_reader.Reset();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(2.0, spd.Find(1.0));
+  EXPECT_EQ(4.0, spd.Find(3.0));
+  EXPECT_EQ(6.0, spd.Find(5.0));
+
+  EXPECT_TRUE(spd_reader.Reset().empty());
+}
+
+TEST(CompactValidatingSpdReader, Uniform) {
+  CompactSpd<float> spd = Read("380 1 385 2 390 3 395 4");
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(4u, spd.size());
+  EXPECT_EQ(395.0, spd.wavelength(3));
+  EXPECT_EQ(4.0, spd.spectral_power(3));
+}
+
+TEST(CompactValidatingSpdReader, GridBreaks) {
+  CompactSpd<float> spd = Read("1 1 2 2 3 3 5 4 6 5");
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(5u, spd.size());
+  EXPECT_EQ(3.0, spd.wavelength(2));
+  EXPECT_EQ(5.0, spd.wavelength(3));
+  EXPECT_EQ(5.0, spd.Find(6.0));
+}
+
+TEST(CompactValidatingSpdReader, OutOfOrder) {
+  CompactSpd<float> spd = Read("4 3 1 1 2 2");
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(1.0, spd.wavelength(0));
+  EXPECT_EQ(2.0, spd.wavelength(1));
+  EXPECT_EQ(4.0, spd.wavelength(2));
+  EXPECT_EQ(1.0, spd.spectral_power(0));
+  EXPECT_EQ(2.0, spd.spectral_power(1));
+  EXPECT_EQ(3.0, spd.spectral_power(2));
+}
+
+TEST(CompactValidatingSpdReader, NegativeWavelength) {
+  std::string input = ReadRunfile("negative_wavelength.spd");
+
+  MockCompactValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_)).Times(0);
+  EXPECT_EQ("The input contained a sample with a negative wavelength",
+            spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(CompactValidatingSpdReader, DuplicateWavelength) {
+  std::string input = ReadRunfile("duplicate_wavelength.spd");
+
+  MockCompactValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(Pair(1.0, 0.0)))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_EQ("The input contained multiple samples with the same wavelength",
+            spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(CompactValidatingSpdReader, DuplicateWavelengthOnGrid) {
+  TestSpdReader spd_reader;
+  EXPECT_EQ("The input contained multiple samples with the same wavelength",
+            spd_reader.ReadFrom(std::string_view("1 0 2 0 3 0 2 0")).error());
+}
+
+TEST(CompactValidatingSpdReader, AllocatesOnlyToGrowArrays) {
+  std::string input;
+  for (int i = 0; i < 1000; i++) {
+    input += std::to_string(380 + i) + " 1\n";
+  }
+
+  TestSpdReader spd_reader;
+
+  size_t allocations = NumAllocations();
+  bool succeeded = spd_reader.ReadFrom(std::string_view(input)).has_value();
+  CompactSpd<float> spd = spd_reader.Reset();
+  allocations = NumAllocations() - allocations;
+
+  // Only the array of spectral powers is allocated, and it grows geometrically
+  EXPECT_TRUE(succeeded);
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(1000u, spd.size());
+  EXPECT_LE(allocations, 16u);
+}
+
+}  // namespace
+}  // namespace libspd
@@ -0,0 +1,66 @@
+#include "libspd/readers/emissive_compact_spd_reader.h"
+
+#include <fstream>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "tools/cpp/runfiles/runfiles.h"
+
+namespace libspd {
+namespace {
+
+using ::bazel::tools::cpp::runfiles::Runfiles;
+
+std::ifstream OpenRunfile(const std::string& filename) {
+  std::unique_ptr<Runfiles> runfiles(Runfiles::CreateForTest());
+  std::string path = "__main__/libspd/readers/test_data/" + filename;
+  return std::ifstream(runfiles->Rlocation(path),
+                       std::ios::in | std::ios::binary);
+}
+
+TEST(ReadEmissiveCompactSpdFrom, ReadsFloat) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  CompactSpd<float> spd = ReadEmissiveCompactSpdFrom<float>(input).value();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(2.0, spd.Find(1.0));
+  EXPECT_EQ(4.0, spd.Find(3.0));
+  EXPECT_EQ(6.0, spd.Find(5.0));
+}
+
+TEST(ReadEmissiveCompactSpdFrom, ReadsDouble) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  CompactSpd<double> spd = ReadEmissiveCompactSpdFrom<double>(input).value();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(2.0, spd.Find(1.0));
+  EXPECT_EQ(4.0, spd.Find(3.0));
+  EXPECT_EQ(6.0, spd.Find(5.0));
+}
+
+TEST(ReadEmissiveCompactSpdFrom, ReadsLongDouble) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  CompactSpd<long double> spd =
+      ReadEmissiveCompactSpdFrom<long double>(input).value();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(2.0, spd.Find(1.0));
+  EXPECT_EQ(4.0, spd.Find(3.0));
+  EXPECT_EQ(6.0, spd.Find(5.0));
+}
+
+TEST(ReadEmissiveCompactSpdFrom, NonUniform) {
+  std::string_view input = "1 0 2 0 4 0";
+  CompactSpd<float> spd = ReadEmissiveCompactSpdFrom<float>(input).value();
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(4.0, spd.wavelength(2));
+}
+
+TEST(ReadEmissiveCompactSpdFrom, Error) {
+  std::string_view input = "1 -1";
+  EXPECT_EQ("The input contained a sample with a negative spectral power",
+            ReadEmissiveCompactSpdFrom<float>(input).error());
+}
+
+}  // namespace
+}  // namespace libspd
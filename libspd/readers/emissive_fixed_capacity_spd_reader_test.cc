@@ -0,0 +1,81 @@
+#include "libspd/readers/emissive_fixed_capacity_spd_reader.h"
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+
+TEST(ReadEmissiveSpdInto, ReadsFloat) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  FixedCapacitySpd<float, 3> spd;
+  EXPECT_TRUE(ReadEmissiveSpdInto(input, spd));
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ReadEmissiveSpdInto, ReadsDouble) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  FixedCapacitySpd<double, 3> spd;
+  EXPECT_TRUE(ReadEmissiveSpdInto(input, spd));
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ReadEmissiveSpdInto, ReadsLongDouble) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  FixedCapacitySpd<long double, 3> spd;
+  EXPECT_TRUE(ReadEmissiveSpdInto(input, spd));
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ReadEmissiveSpdInto, TooManySamples) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  FixedCapacitySpd<float, 2> spd;
+  EXPECT_EQ("The input contained more samples than the maximum supported",
+            ReadEmissiveSpdInto(input, spd).error());
+  EXPECT_THAT(spd, IsEmpty());
+}
+
+TEST(ParseEmissiveSpd, ParsesFloat) {
+  constexpr FixedCapacitySpd<float, 4> spd =
+      ParseEmissiveSpd<float, 4>("#Comment\n1.0 2.0\n5.0 6.0\n3.0 4.0");
+  static_assert(spd.size() == 3);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ParseEmissiveSpd, ParsesDouble) {
+  constexpr FixedCapacitySpd<double, 4> spd =
+      ParseEmissiveSpd<double, 4>("#Comment\n1.0 2.0\n5.0 6.0\n3.0 4.0");
+  static_assert(spd.size() == 3);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ParseEmissiveSpd, ParsesLongDouble) {
+  constexpr FixedCapacitySpd<long double, 4> spd =
+      ParseEmissiveSpd<long double, 4>("#Comment\n1.0 2.0\n5.0 6.0\n3.0 4.0");
+  static_assert(spd.size() == 3);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ParseEmissiveSpd, ParsesBytes) {
+  // The same input as `#embed` would produce for a file
+  constexpr unsigned char kInput[] = {'1', ' ', '2', '\n', '3', ' ', '4'};
+  constexpr FixedCapacitySpd<float, 4> spd =
+      ParseEmissiveSpd<float, 4>(kInput);
+  static_assert(spd.size() == 2);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0)));
+}
+
+TEST(ReadEmissiveSpdInto, FailsDuringConstantEvaluation) {
+  constexpr bool succeeded = [] {
+    FixedCapacitySpd<float, 4> spd;
+    return ReadEmissiveSpdInto("1.0 -1.0", spd).has_value();
+  }();
+  static_assert(!succeeded);
+}
+
+}  // namespace
+}  // namespace libspd
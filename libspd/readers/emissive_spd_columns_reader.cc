@@ -0,0 +1,69 @@
+#include "libspd/readers/emissive_spd_columns_reader.h"
+
+namespace libspd {
+namespace {
+
+template <std::floating_point Type>
+class EmissiveColumnarSpdReader final
+    : public ValidatingColumnarSpdReader<Type> {
+ public:
+  using ValidatingColumnarSpdReader<Type>::ValidatingColumnarSpdReader;
+
+ protected:
+  virtual std::expected<void, std::string> HandleSample(
+      size_t column, std::pair<const Type, Type>& sample) override {
+    return std::expected<void, std::string>();
+  }
+};
+
+template <std::floating_point Type, typename Input>
+std::expected<std::vector<NamedSpd<Type>>, std::string> ReadSpdColumns(
+    Input&& input, ColumnarFormat format) {
+  EmissiveColumnarSpdReader<Type> reader(format);
+
+  std::expected<void, std::string> result = reader.ReadFrom(input);
+  if (!result) {
+    return std::unexpected(std::move(result.error()));
+  }
+
+  return reader.Reset();
+}
+
+}  // namespace
+
+std::expected<std::vector<NamedSpd<long double>>, std::string>
+ReadEmissiveSpdColumnsAsLongDoublesFrom(std::istream& input,
+                                        ColumnarFormat format) {
+  return ReadSpdColumns<long double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<long double>>, std::string>
+ReadEmissiveSpdColumnsAsLongDoublesFrom(std::string_view input,
+                                        ColumnarFormat format) {
+  return ReadSpdColumns<long double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<double>>, std::string>
+ReadEmissiveSpdColumnsAsDoublesFrom(std::istream& input,
+                                    ColumnarFormat format) {
+  return ReadSpdColumns<double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<double>>, std::string>
+ReadEmissiveSpdColumnsAsDoublesFrom(std::string_view input,
+                                    ColumnarFormat format) {
+  return ReadSpdColumns<double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<float>>, std::string>
+ReadEmissiveSpdColumnsAsFloatsFrom(std::istream& input, ColumnarFormat format) {
+  return ReadSpdColumns<float>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<float>>, std::string>
+ReadEmissiveSpdColumnsAsFloatsFrom(std::string_view input,
+                                   ColumnarFormat format) {
+  return ReadSpdColumns<float>(input, format);
+}
+
+}  // namespace libspd
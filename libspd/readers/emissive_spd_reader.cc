@@ -6,8 +6,9 @@
 namespace libspd {
 namespace {
 
-template <std::floating_point Type>
-class EmissiveSpdReader final : public ValidatingSpdReader<Type> {
+template <std::floating_point Type, SpdAccumulator<Type>... Accumulators>
+class EmissiveSpdReader final
+    : public ValidatingSpdReader<Type, Accumulators...> {
  protected:
   virtual std::expected<void, std::string> HandleComment(
       std::string_view comment) override {
@@ -20,11 +21,9 @@ class EmissiveSpdReader final : public ValidatingSpdReader<Type> {
   }
 };
 
-}  // namespace
-
-std::expected<std::map<long double, long double>, std::string>
-ReadEmissiveSpdAsLongDoublesFrom(std::istream& input) {
-  EmissiveSpdReader<long double> reader;
+template <std::floating_point Type, typename Input>
+std::expected<std::map<Type, Type>, std::string> ReadSpd(Input&& input) {
+  EmissiveSpdReader<Type> reader;
 
   std::expected<void, std::string> result = reader.ReadFrom(input);
   if (!result) {
@@ -34,28 +33,83 @@ ReadEmissiveSpdAsLongDoublesFrom(std::istream& input) {
   return reader.Reset();
 }
 
-std::expected<std::map<double, double>, std::string>
-ReadEmissiveSpdAsDoublesFrom(std::istream& input) {
-  EmissiveSpdReader<double> reader;
+template <std::floating_point Type, typename Input>
+std::expected<SpdWithStatistics<Type>, std::string> ReadSpdWithStatistics(
+    Input&& input) {
+  EmissiveSpdReader<Type, SpdStatisticsAccumulator<Type>> reader;
 
   std::expected<void, std::string> result = reader.ReadFrom(input);
   if (!result) {
     return std::unexpected(std::move(result.error()));
   }
 
-  return reader.Reset();
+  SpdWithStatistics<Type> spd;
+  spd.statistics = std::get<0>(reader.GetAccumulators()).statistics();
+  spd.samples = reader.Reset();
+
+  return spd;
+}
+
+}  // namespace
+
+std::expected<std::map<long double, long double>, std::string>
+ReadEmissiveSpdAsLongDoublesFrom(std::istream& input) {
+  return ReadSpd<long double>(input);
+}
+
+std::expected<std::map<long double, long double>, std::string>
+ReadEmissiveSpdAsLongDoublesFrom(std::string_view input) {
+  return ReadSpd<long double>(input);
+}
+
+std::expected<std::map<double, double>, std::string>
+ReadEmissiveSpdAsDoublesFrom(std::istream& input) {
+  return ReadSpd<double>(input);
+}
+
+std::expected<std::map<double, double>, std::string>
+ReadEmissiveSpdAsDoublesFrom(std::string_view input) {
+  return ReadSpd<double>(input);
 }
 
 std::expected<std::map<float, float>, std::string> ReadEmissiveSpdAsFloatsFrom(
     std::istream& input) {
-  EmissiveSpdReader<float> reader;
+  return ReadSpd<float>(input);
+}
 
-  std::expected<void, std::string> result = reader.ReadFrom(input);
-  if (!result) {
-    return std::unexpected(std::move(result.error()));
-  }
+std::expected<std::map<float, float>, std::string> ReadEmissiveSpdAsFloatsFrom(
+    std::string_view input) {
+  return ReadSpd<float>(input);
+}
 
-  return reader.Reset();
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadEmissiveSpdWithStatisticsAsLongDoublesFrom(std::istream& input) {
+  return ReadSpdWithStatistics<long double>(input);
+}
+
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadEmissiveSpdWithStatisticsAsLongDoublesFrom(std::string_view input) {
+  return ReadSpdWithStatistics<long double>(input);
+}
+
+std::expected<SpdWithStatistics<double>, std::string>
+ReadEmissiveSpdWithStatisticsAsDoublesFrom(std::istream& input) {
+  return ReadSpdWithStatistics<double>(input);
+}
+
+std::expected<SpdWithStatistics<double>, std::string>
+ReadEmissiveSpdWithStatisticsAsDoublesFrom(std::string_view input) {
+  return ReadSpdWithStatistics<double>(input);
+}
+
+std::expected<SpdWithStatistics<float>, std::string>
+ReadEmissiveSpdWithStatisticsAsFloatsFrom(std::istream& input) {
+  return ReadSpdWithStatistics<float>(input);
+}
+
+std::expected<SpdWithStatistics<float>, std::string>
+ReadEmissiveSpdWithStatisticsAsFloatsFrom(std::string_view input) {
+  return ReadSpdWithStatistics<float>(input);
 }
 
 }  // namespace libspd
\ No newline at end of file
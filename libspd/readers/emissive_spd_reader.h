@@ -6,8 +6,11 @@
 #include <istream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
+#include "libspd/readers/spd_accumulators.h"
+
 namespace libspd {
 
 // NOTE: Behavior is undefined if input is not a binary stream
@@ -22,6 +25,39 @@ ReadEmissiveSpdAsDoublesFrom(std::istream& input);
 std::expected<std::map<float, float>, std::string> ReadEmissiveSpdAsFloatsFrom(
     std::istream& input);
 
+std::expected<std::map<long double, long double>, std::string>
+ReadEmissiveSpdAsLongDoublesFrom(std::string_view input);
+
+std::expected<std::map<double, double>, std::string>
+ReadEmissiveSpdAsDoublesFrom(std::string_view input);
+
+std::expected<std::map<float, float>, std::string> ReadEmissiveSpdAsFloatsFrom(
+    std::string_view input);
+
+// The functions below additionally return statistics about the samples which
+// are computed while the input is parsed
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadEmissiveSpdWithStatisticsAsLongDoublesFrom(std::istream& input);
+
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadEmissiveSpdWithStatisticsAsLongDoublesFrom(std::string_view input);
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<SpdWithStatistics<double>, std::string>
+ReadEmissiveSpdWithStatisticsAsDoublesFrom(std::istream& input);
+
+std::expected<SpdWithStatistics<double>, std::string>
+ReadEmissiveSpdWithStatisticsAsDoublesFrom(std::string_view input);
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<SpdWithStatistics<float>, std::string>
+ReadEmissiveSpdWithStatisticsAsFloatsFrom(std::istream& input);
+
+std::expected<SpdWithStatistics<float>, std::string>
+ReadEmissiveSpdWithStatisticsAsFloatsFrom(std::string_view input);
+
 // NOTE: Behavior is undefined if input is not a binary stream
 template <std::floating_point Type>
 std::expected<std::map<Type, Type>, std::string> ReadEmissiveSpdFrom(
@@ -35,6 +71,43 @@ std::expected<std::map<Type, Type>, std::string> ReadEmissiveSpdFrom(
   }
 }
 
+template <std::floating_point Type>
+std::expected<std::map<Type, Type>, std::string> ReadEmissiveSpdFrom(
+    std::string_view input) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadEmissiveSpdAsLongDoublesFrom(input);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadEmissiveSpdAsDoublesFrom(input);
+  } else {
+    return ReadEmissiveSpdAsFloatsFrom(input);
+  }
+}
+
+// NOTE: Behavior is undefined if input is not a binary stream
+template <std::floating_point Type>
+std::expected<SpdWithStatistics<Type>, std::string>
+ReadEmissiveSpdWithStatisticsFrom(std::istream& input) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadEmissiveSpdWithStatisticsAsLongDoublesFrom(input);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadEmissiveSpdWithStatisticsAsDoublesFrom(input);
+  } else {
+    return ReadEmissiveSpdWithStatisticsAsFloatsFrom(input);
+  }
+}
+
+template <std::floating_point Type>
+std::expected<SpdWithStatistics<Type>, std::string>
+ReadEmissiveSpdWithStatisticsFrom(std::string_view input) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadEmissiveSpdWithStatisticsAsLongDoublesFrom(input);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadEmissiveSpdWithStatisticsAsDoublesFrom(input);
+  } else {
+    return ReadEmissiveSpdWithStatisticsAsFloatsFrom(input);
+  }
+}
+
 }  // namespace libspd
 
 #endif  // _LIBSPD_READERS_EMISSIVE_SPD_READER_
\ No newline at end of file
@@ -38,5 +38,71 @@ TEST(ReadEmissiveSpdFrom, ReadsLongDouble) {
               ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
 }
 
+TEST(ReadEmissiveSpdFrom, ReadsFloatFromString) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  EXPECT_THAT(ReadEmissiveSpdFrom<float>(input).value(),
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ReadEmissiveSpdFrom, ReadsDoubleFromString) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  EXPECT_THAT(ReadEmissiveSpdFrom<double>(input).value(),
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ReadEmissiveSpdFrom, ReadsLongDoubleFromString) {
+  std::string_view input = "1.0 2.0\n5.0 6.0\n3.0 4.0";
+  EXPECT_THAT(ReadEmissiveSpdFrom<long double>(input).value(),
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+TEST(ReadEmissiveSpdWithStatisticsFrom, ReadsFloat) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  auto result = ReadEmissiveSpdWithStatisticsFrom<float>(input).value();
+  EXPECT_THAT(result.samples,
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+  EXPECT_EQ(3u, result.statistics.num_samples);
+  EXPECT_EQ(1.0, result.statistics.min_wavelength);
+  EXPECT_EQ(5.0, result.statistics.max_wavelength);
+  EXPECT_EQ(6.0, result.statistics.peak_spectral_power);
+  EXPECT_EQ(5.0, result.statistics.peak_wavelength);
+  EXPECT_EQ(16.0, result.statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, result.statistics.min_sample_spacing);
+  EXPECT_TRUE(result.statistics.uniformly_spaced);
+  EXPECT_FALSE(result.statistics.monotonic);
+}
+
+TEST(ReadEmissiveSpdWithStatisticsFrom, ReadsDouble) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  auto result = ReadEmissiveSpdWithStatisticsFrom<double>(input).value();
+  EXPECT_THAT(result.samples,
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+  EXPECT_EQ(3u, result.statistics.num_samples);
+  EXPECT_EQ(1.0, result.statistics.min_wavelength);
+  EXPECT_EQ(5.0, result.statistics.max_wavelength);
+  EXPECT_EQ(6.0, result.statistics.peak_spectral_power);
+  EXPECT_EQ(5.0, result.statistics.peak_wavelength);
+  EXPECT_EQ(16.0, result.statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, result.statistics.min_sample_spacing);
+  EXPECT_TRUE(result.statistics.uniformly_spaced);
+  EXPECT_FALSE(result.statistics.monotonic);
+}
+
+TEST(ReadEmissiveSpdWithStatisticsFrom, ReadsLongDouble) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  auto result = ReadEmissiveSpdWithStatisticsFrom<long double>(input).value();
+  EXPECT_THAT(result.samples,
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+  EXPECT_EQ(3u, result.statistics.num_samples);
+  EXPECT_EQ(1.0, result.statistics.min_wavelength);
+  EXPECT_EQ(5.0, result.statistics.max_wavelength);
+  EXPECT_EQ(6.0, result.statistics.peak_spectral_power);
+  EXPECT_EQ(5.0, result.statistics.peak_wavelength);
+  EXPECT_EQ(16.0, result.statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, result.statistics.min_sample_spacing);
+  EXPECT_TRUE(result.statistics.uniformly_spaced);
+  EXPECT_FALSE(result.statistics.monotonic);
+}
+
 }  // namespace
 }  // namespace libspd
\ No newline at end of file
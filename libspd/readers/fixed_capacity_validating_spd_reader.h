@@ -0,0 +1,142 @@
+#ifndef _LIBSPD_READERS_FIXED_CAPACITY_VALIDATING_SPD_READER_
+#define _LIBSPD_READERS_FIXED_CAPACITY_VALIDATING_SPD_READER_
+
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "libspd/fixed_capacity_spd.h"
+#include "libspd/readers/validating_spd_reader.h"
+#include "libspd/spd_reader.h"
+
+namespace libspd {
+namespace internal {
+
+// Not `constexpr`, so calling this during constant evaluation fails to compile
+// and the compiler quotes the line making the call, including its argument.
+inline std::string_view InvalidSpd(std::string_view reason) { return reason; }
+
+// Called by the functions that parse SPD files at compile time when the input
+// is malformed. Each error returned by the library is passed to `InvalidSpd`
+// from a line of its own so that the diagnostic includes the reason, while the
+// input appears in the notes showing how the call was reached. Other errors are
+// returned unchanged for the caller to report, as is every error at runtime.
+constexpr std::string_view ReportInvalidSpd(std::string_view error) {
+  if (error == "The input contained mismatched line endings") {
+    return InvalidSpd("The input contained mismatched line endings");
+  }
+
+  if (error == "The input contained an unparsable token") {
+    return InvalidSpd("The input contained an unparsable token");
+  }
+
+  if (error ==
+      "The input contained a token that cannot be parsed exactly at compile "
+      "time") {
+    return InvalidSpd(
+        "The input contained a token that cannot be parsed exactly at compile "
+        "time");
+  }
+
+  if (error == "The input contained an odd number of tokens") {
+    return InvalidSpd("The input contained an odd number of tokens");
+  }
+
+  if (error == "The input contained a sample with a negative wavelength") {
+    return InvalidSpd(
+        "The input contained a sample with a negative wavelength");
+  }
+
+  if (error == "The input contained a sample with a negative spectral power") {
+    return InvalidSpd(
+        "The input contained a sample with a negative spectral power");
+  }
+
+  if (error == "The input contained a sample with a wavelength of zero") {
+    return InvalidSpd("The input contained a sample with a wavelength of zero");
+  }
+
+  if (error == "The input contained a sample with a non-finite wavelength") {
+    return InvalidSpd(
+        "The input contained a sample with a non-finite wavelength");
+  }
+
+  if (error ==
+      "The input contained a sample with a non-finite spectral power") {
+    return InvalidSpd(
+        "The input contained a sample with a non-finite spectral power");
+  }
+
+  if (error ==
+      "The input contained multiple samples with the same wavelength") {
+    return InvalidSpd(
+        "The input contained multiple samples with the same wavelength");
+  }
+
+  if (error == "The input contained more samples than the maximum supported") {
+    return InvalidSpd(
+        "The input contained more samples than the maximum supported");
+  }
+
+  if (error ==
+      "The input contained a sample with a spectral power greater than one") {
+    return InvalidSpd(
+        "The input contained a sample with a spectral power greater than one");
+  }
+
+  return error;
+}
+
+}  // namespace internal
+
+// A variant of `ValidatingSpdReader` that stores its samples inline in a
+// `FixedCapacitySpd` instead of a `std::map`. When used with
+// `SpdReader::ReadFrom(std::string_view)` no heap allocations are performed
+// unless an error is returned and if the derived class implements its handlers
+// as `constexpr` the reader may also be used during constant evaluation.
+template <std::floating_point Type, size_t Capacity>
+class FixedCapacityValidatingSpdReader : public SpdReader {
+ private:
+  FixedCapacitySpd<Type, Capacity> samples_;
+
+ public:
+  constexpr FixedCapacitySpd<Type, Capacity> Reset() {
+    FixedCapacitySpd<Type, Capacity> result = samples_;
+    samples_.clear();
+    return result;
+  }
+
+ protected:
+  virtual constexpr std::expected<void, std::string> HandleSample(
+      const std::pair<Type, Type>& sample) = 0;
+
+  constexpr std::expected<void, std::string> HandleSample(
+      long double wavelength, long double spectral_power) final override {
+    std::expected<std::pair<Type, Type>, std::string> sample =
+        ValidateSample<Type>(wavelength, spectral_power);
+    if (!sample) {
+      return std::unexpected(std::move(sample.error()));
+    }
+
+    auto [iter, inserted] =
+        samples_.try_emplace(sample->first, sample->second);
+    if (!inserted) {
+      if (iter == samples_.end()) {
+        return std::unexpected(
+            "The input contained more samples than the maximum supported");
+      }
+
+      return std::unexpected(
+          "The input contained multiple samples with the same wavelength");
+    }
+
+    return HandleSample(*iter);
+  }
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_FIXED_CAPACITY_VALIDATING_SPD_READER_
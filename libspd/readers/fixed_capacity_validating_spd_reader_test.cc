@@ -0,0 +1,171 @@
+#include "libspd/readers/fixed_capacity_validating_spd_reader.h"
+
+#include <fstream>
+#include <iterator>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/readers/allocation_counter.h"
+#include "tools/cpp/runfiles/runfiles.h"
+
+namespace libspd {
+namespace {
+
+using ::bazel::tools::cpp::runfiles::Runfiles;
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::InSequence;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+using ::testing::Return;
+
+class MockFixedCapacityValidatingSpdReader final
+    : public FixedCapacityValidatingSpdReader<float, 3> {
+ public:
+  MOCK_METHOD((std::expected<void, std::string>), HandleComment,
+              (std::string_view), (override));
+  MOCK_METHOD((std::expected<void, std::string>), HandleSample,
+              ((const std::pair<float, float>)&), (override));
+};
+
+std::string ReadRunfile(const std::string& filename) {
+  std::unique_ptr<Runfiles> runfiles(Runfiles::CreateForTest());
+  std::string path = "__main__/libspd/readers/test_data/" + filename;
+  std::ifstream input(runfiles->Rlocation(path),
+                      std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(input),
+                     std::istreambuf_iterator<char>());
+}
+
+TEST(FixedCapacityValidatingSpdReader, Nothing) {
+  MockFixedCapacityValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_)).Times(0);
+  EXPECT_THAT(spd_reader.Reset(), IsEmpty());
+}
+
+TEST(FixedCapacityValidatingSpdReader, ReturnsSampleError) {
+  std::string input = ReadRunfile("well_formed.spd");
+
+  MockFixedCapacityValidatingSpdReader spd_reader;
+
+  EXPECT_CALL(spd_reader, HandleComment("Comment"))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(spd_reader, HandleSample(Pair(1.0, 2.0)))
+      .WillOnce(Return(std::unexpected("error")));
+
+  EXPECT_EQ("error", spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(FixedCapacityValidatingSpdReader, WellFormed) {
+  std::string input = ReadRunfile("well_formed.spd");
+
+  MockFixedCapacityValidatingSpdReader spd_reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(spd_reader, HandleComment("Comment"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(Pair(1.0, 2.0)))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(Pair(5.0, 6.0)))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(Pair(3.0, 4.0)))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(spd_reader.ReadFrom(std::string_view(input)));
+  EXPECT_THAT(spd_reader.Reset(),
+              ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+  EXPECT_THAT(spd_reader.Reset(), IsEmpty());
+}
+
+TEST(FixedCapacityValidatingSpdReader, NegativeWavelength) {
+  std::string input = ReadRunfile("negative_wavelength.spd");
+
+  MockFixedCapacityValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_)).Times(0);
+  EXPECT_EQ("The input contained a sample with a negative wavelength",
+            spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(FixedCapacityValidatingSpdReader, DuplicateWavelength) {
+  std::string input = ReadRunfile("duplicate_wavelength.spd");
+
+  MockFixedCapacityValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(Pair(1.0, 0.0)))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_EQ("The input contained multiple samples with the same wavelength",
+            spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(FixedCapacityValidatingSpdReader, TooManySamples) {
+  MockFixedCapacityValidatingSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_))
+      .Times(3)
+      .WillRepeatedly(Return(std::expected<void, std::string>()));
+  EXPECT_EQ("The input contained more samples than the maximum supported",
+            spd_reader.ReadFrom(std::string_view("1 0 2 0 3 0 4 0")).error());
+}
+
+class NonAllocatingSpdReader final
+    : public FixedCapacityValidatingSpdReader<float, 3> {
+ protected:
+  std::expected<void, std::string> HandleComment(
+      std::string_view comment) override {
+    return std::expected<void, std::string>();
+  }
+
+  std::expected<void, std::string> HandleSample(
+      const std::pair<float, float>& sample) override {
+    return std::expected<void, std::string>();
+  }
+};
+
+TEST(FixedCapacityValidatingSpdReader, DoesNotAllocate) {
+  std::string input = ReadRunfile("well_formed.spd");
+
+  NonAllocatingSpdReader spd_reader;
+
+  size_t allocations = NumAllocations();
+  bool succeeded = spd_reader.ReadFrom(std::string_view(input)).has_value();
+  FixedCapacitySpd<float, 3> spd = spd_reader.Reset();
+  allocations = NumAllocations() - allocations;
+
+  EXPECT_TRUE(succeeded);
+  EXPECT_EQ(0u, allocations);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0), Pair(5.0, 6.0)));
+}
+
+// `ReportInvalidSpd` returns its argument if it does not recognize the error
+// and otherwise the copy of the error passed to `InvalidSpd`
+bool IsReported(const std::string& error) {
+  std::string_view reported = internal::ReportInvalidSpd(error);
+  return reported == error && reported.data() != error.data();
+}
+
+TEST(ReportInvalidSpd, ReportsReaderErrors) {
+  for (std::string_view input :
+       {"1 2\r\n3 4\n", "a 1", "1", "-1 1", "1 -1", "1e-50 1", "1e50 1",
+        "1 1e50", "1 1 1 1", "1 0 2 0 3 0 4 0"}) {
+    NonAllocatingSpdReader spd_reader;
+    std::expected<void, std::string> result = spd_reader.ReadFrom(input);
+    ASSERT_FALSE(result) << input;
+    EXPECT_TRUE(IsReported(result.error())) << result.error();
+  }
+}
+
+TEST(ReportInvalidSpd, ReportsOtherErrors) {
+  EXPECT_TRUE(IsReported(
+      "The input contained a token that cannot be parsed exactly at compile "
+      "time"));
+  EXPECT_TRUE(IsReported(
+      "The input contained a sample with a spectral power greater than one"));
+  EXPECT_FALSE(IsReported("error"));
+}
+
+}  // namespace
+}  // namespace libspd
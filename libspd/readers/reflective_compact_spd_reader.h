@@ -0,0 +1,66 @@
+#ifndef _LIBSPD_READERS_REFLECTIVE_COMPACT_SPD_READER_
+#define _LIBSPD_READERS_REFLECTIVE_COMPACT_SPD_READER_
+
+#include <concepts>
+#include <expected>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "libspd/compact_spd.h"
+#include "libspd/readers/compact_validating_spd_reader.h"
+#include "libspd/readers/reflective_spd_reader.h"
+
+namespace libspd {
+namespace internal {
+
+template <std::floating_point Type>
+class ReflectiveCompactSpdReader final
+    : public CompactValidatingSpdReader<Type> {
+ protected:
+  std::expected<void, std::string> HandleComment(
+      std::string_view comment) override {
+    return std::expected<void, std::string>();
+  }
+
+  std::expected<void, std::string> HandleSample(
+      const std::pair<Type, Type>& sample) override {
+    return ValidateReflectiveSpectralPower(sample.second);
+  }
+};
+
+template <std::floating_point Type, typename Input>
+std::expected<CompactSpd<Type>, std::string> ReadReflectiveCompactSpd(
+    Input& input) {
+  ReflectiveCompactSpdReader<Type> reader;
+
+  std::expected<void, std::string> result = reader.ReadFrom(input);
+  if (!result) {
+    return std::unexpected(std::move(result.error()));
+  }
+
+  return reader.Reset();
+}
+
+}  // namespace internal
+
+// Reads an SPD file into a `CompactSpd`. Only the spectral powers are stored
+// while the samples continue the grid formed by the first two wavelengths.
+//
+// NOTE: Behavior is undefined if input is not a binary stream
+template <std::floating_point Type>
+std::expected<CompactSpd<Type>, std::string> ReadReflectiveCompactSpdFrom(
+    std::istream& input) {
+  return internal::ReadReflectiveCompactSpd<Type>(input);
+}
+
+template <std::floating_point Type>
+std::expected<CompactSpd<Type>, std::string> ReadReflectiveCompactSpdFrom(
+    std::string_view input) {
+  return internal::ReadReflectiveCompactSpd<Type>(input);
+}
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_REFLECTIVE_COMPACT_SPD_READER_
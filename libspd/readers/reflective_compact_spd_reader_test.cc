@@ -0,0 +1,66 @@
+#include "libspd/readers/reflective_compact_spd_reader.h"
+
+#include <fstream>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "tools/cpp/runfiles/runfiles.h"
+
+namespace libspd {
+namespace {
+
+using ::bazel::tools::cpp::runfiles::Runfiles;
+
+std::ifstream OpenRunfile(const std::string& filename) {
+  std::unique_ptr<Runfiles> runfiles(Runfiles::CreateForTest());
+  std::string path = "__main__/libspd/readers/test_data/" + filename;
+  return std::ifstream(runfiles->Rlocation(path),
+                       std::ios::in | std::ios::binary);
+}
+
+TEST(ReadReflectiveCompactSpdFrom, ReadsFloat) {
+  std::ifstream input = OpenRunfile("well_formed_reflective.spd");
+  CompactSpd<float> spd = ReadReflectiveCompactSpdFrom<float>(input).value();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(1.0, spd.Find(1.0));
+  EXPECT_EQ(0.0, spd.Find(3.0));
+  EXPECT_EQ(0.5, spd.Find(5.0));
+}
+
+TEST(ReadReflectiveCompactSpdFrom, ReadsDouble) {
+  std::ifstream input = OpenRunfile("well_formed_reflective.spd");
+  CompactSpd<double> spd = ReadReflectiveCompactSpdFrom<double>(input).value();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(1.0, spd.Find(1.0));
+  EXPECT_EQ(0.0, spd.Find(3.0));
+  EXPECT_EQ(0.5, spd.Find(5.0));
+}
+
+TEST(ReadReflectiveCompactSpdFrom, ReadsLongDouble) {
+  std::ifstream input = OpenRunfile("well_formed_reflective.spd");
+  CompactSpd<long double> spd =
+      ReadReflectiveCompactSpdFrom<long double>(input).value();
+  EXPECT_TRUE(spd.uniform());
+  EXPECT_EQ(3u, spd.size());
+  EXPECT_EQ(1.0, spd.Find(1.0));
+  EXPECT_EQ(0.0, spd.Find(3.0));
+  EXPECT_EQ(0.5, spd.Find(5.0));
+}
+
+TEST(ReadReflectiveCompactSpdFrom, NonUniform) {
+  std::string_view input = "1 0 2 0 4 0";
+  CompactSpd<float> spd = ReadReflectiveCompactSpdFrom<float>(input).value();
+  EXPECT_FALSE(spd.uniform());
+  EXPECT_EQ(4.0, spd.wavelength(2));
+}
+
+TEST(ReadReflectiveCompactSpdFrom, Error) {
+  std::string_view input = "1 -1";
+  EXPECT_EQ("The input contained a sample with a negative spectral power",
+            ReadReflectiveCompactSpdFrom<float>(input).error());
+}
+
+}  // namespace
+}  // namespace libspd
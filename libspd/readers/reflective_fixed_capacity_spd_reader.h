@@ -0,0 +1,85 @@
+#ifndef _LIBSPD_READERS_REFLECTIVE_FIXED_CAPACITY_SPD_READER_
+#define _LIBSPD_READERS_REFLECTIVE_FIXED_CAPACITY_SPD_READER_
+
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "libspd/fixed_capacity_spd.h"
+#include "libspd/readers/fixed_capacity_validating_spd_reader.h"
+#include "libspd/readers/reflective_spd_reader.h"
+
+namespace libspd {
+
+// Reads an SPD file into inline storage without performing any heap
+// allocations, returning an error if the input contains more than `Capacity`
+// samples. On error, `output` is left unmodified. This function may also be
+// used during constant evaluation.
+template <std::floating_point Type, size_t Capacity>
+constexpr std::expected<void, std::string> ReadReflectiveSpdInto(
+    std::string_view input, FixedCapacitySpd<Type, Capacity>& output) {
+  class ReflectiveSpdReader final
+      : public FixedCapacityValidatingSpdReader<Type, Capacity> {
+   protected:
+    constexpr std::expected<void, std::string> HandleComment(
+        std::string_view comment) override {
+      return std::expected<void, std::string>();
+    }
+
+    constexpr std::expected<void, std::string> HandleSample(
+        const std::pair<Type, Type>& sample) override {
+      return ValidateReflectiveSpectralPower(sample.second);
+    }
+  };
+
+  ReflectiveSpdReader reader;
+
+  std::expected<void, std::string> result = reader.ReadFrom(input);
+  if (!result) {
+    return result;
+  }
+
+  output = reader.Reset();
+
+  return std::expected<void, std::string>();
+}
+
+// Parses an SPD file at compile time, for instance to embed a spectrum in a
+// program without doing any work at startup. Input that would cause
+// `ReadReflectiveSpdInto` to return an error fails to compile with a diagnostic
+// that includes the error.
+template <std::floating_point Type, size_t Capacity>
+consteval FixedCapacitySpd<Type, Capacity> ParseReflectiveSpd(
+    std::string_view input) {
+  FixedCapacitySpd<Type, Capacity> output;
+  if (std::expected<void, std::string> result =
+          ReadReflectiveSpdInto(input, output);
+      !result) {
+    internal::ReportInvalidSpd(result.error());
+    internal::InvalidSpd(result.error());
+  }
+
+  return output;
+}
+
+// Parses the bytes of an SPD file at compile time. This accepts the output of
+// `#embed`, which expands to a list of integers rather than a string literal:
+//
+//   constexpr unsigned char kSpectrum[] = {
+//   #embed "spectrum.spd"
+//   };
+//   constexpr auto spd = ParseReflectiveSpd<float, 128>(kSpectrum);
+template <std::floating_point Type, size_t Capacity>
+consteval FixedCapacitySpd<Type, Capacity> ParseReflectiveSpd(
+    std::span<const unsigned char> input) {
+  return ParseReflectiveSpd<Type, Capacity>(
+      std::string_view(std::string(input.begin(), input.end())));
+}
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_REFLECTIVE_FIXED_CAPACITY_SPD_READER_
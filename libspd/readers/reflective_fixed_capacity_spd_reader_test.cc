@@ -0,0 +1,88 @@
+#include "libspd/readers/reflective_fixed_capacity_spd_reader.h"
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+
+TEST(ReadReflectiveSpdInto, ReadsFloat) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  FixedCapacitySpd<float, 3> spd;
+  EXPECT_TRUE(ReadReflectiveSpdInto(input, spd));
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdInto, ReadsDouble) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  FixedCapacitySpd<double, 3> spd;
+  EXPECT_TRUE(ReadReflectiveSpdInto(input, spd));
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdInto, ReadsLongDouble) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  FixedCapacitySpd<long double, 3> spd;
+  EXPECT_TRUE(ReadReflectiveSpdInto(input, spd));
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdInto, TooManySamples) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  FixedCapacitySpd<float, 2> spd;
+  EXPECT_EQ("The input contained more samples than the maximum supported",
+            ReadReflectiveSpdInto(input, spd).error());
+  EXPECT_THAT(spd, IsEmpty());
+}
+
+TEST(ReadReflectiveSpdInto, TooLarge) {
+  FixedCapacitySpd<float, 2> spd;
+  EXPECT_EQ(
+      "The input contained a sample with a spectral power greater than one",
+      ReadReflectiveSpdInto(std::string_view("1.0 2.0"), spd).error());
+}
+
+TEST(ParseReflectiveSpd, ParsesFloat) {
+  constexpr FixedCapacitySpd<float, 4> spd =
+      ParseReflectiveSpd<float, 4>("#Comment\n1.0 1.0\n5.0 0.5\n3.0 0.0");
+  static_assert(spd.size() == 3);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ParseReflectiveSpd, ParsesDouble) {
+  constexpr FixedCapacitySpd<double, 4> spd =
+      ParseReflectiveSpd<double, 4>("#Comment\n1.0 1.0\n5.0 0.5\n3.0 0.0");
+  static_assert(spd.size() == 3);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ParseReflectiveSpd, ParsesLongDouble) {
+  constexpr FixedCapacitySpd<long double, 4> spd =
+      ParseReflectiveSpd<long double, 4>("#Comment\n1.0 1.0\n5.0 0.5\n3.0 0.0");
+  static_assert(spd.size() == 3);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ParseReflectiveSpd, ParsesBytes) {
+  // The same input as `#embed` would produce for a file
+  constexpr unsigned char kInput[] = {'1', ' ', '1', '\n', '3', ' ', '0'};
+  constexpr FixedCapacitySpd<float, 4> spd =
+      ParseReflectiveSpd<float, 4>(kInput);
+  static_assert(spd.size() == 2);
+  EXPECT_THAT(spd, ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0)));
+}
+
+TEST(ReadReflectiveSpdInto, FailsDuringConstantEvaluation) {
+  constexpr bool succeeded = [] {
+    FixedCapacitySpd<float, 4> spd;
+    return ReadReflectiveSpdInto("1.0 2.0", spd).has_value();
+  }();
+  static_assert(!succeeded);
+}
+
+}  // namespace
+}  // namespace libspd
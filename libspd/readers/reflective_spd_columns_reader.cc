@@ -0,0 +1,72 @@
+#include "libspd/readers/reflective_spd_columns_reader.h"
+
+#include "libspd/readers/reflective_spd_reader.h"
+
+namespace libspd {
+namespace {
+
+template <std::floating_point Type>
+class ReflectiveColumnarSpdReader final
+    : public ValidatingColumnarSpdReader<Type> {
+ public:
+  using ValidatingColumnarSpdReader<Type>::ValidatingColumnarSpdReader;
+
+ protected:
+  virtual std::expected<void, std::string> HandleSample(
+      size_t column, std::pair<const Type, Type>& sample) override {
+    return ValidateReflectiveSpectralPower(sample.second);
+  }
+};
+
+template <std::floating_point Type, typename Input>
+std::expected<std::vector<NamedSpd<Type>>, std::string> ReadSpdColumns(
+    Input&& input, ColumnarFormat format) {
+  ReflectiveColumnarSpdReader<Type> reader(format);
+
+  std::expected<void, std::string> result = reader.ReadFrom(input);
+  if (!result) {
+    return std::unexpected(std::move(result.error()));
+  }
+
+  return reader.Reset();
+}
+
+}  // namespace
+
+std::expected<std::vector<NamedSpd<long double>>, std::string>
+ReadReflectiveSpdColumnsAsLongDoublesFrom(std::istream& input,
+                                          ColumnarFormat format) {
+  return ReadSpdColumns<long double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<long double>>, std::string>
+ReadReflectiveSpdColumnsAsLongDoublesFrom(std::string_view input,
+                                          ColumnarFormat format) {
+  return ReadSpdColumns<long double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<double>>, std::string>
+ReadReflectiveSpdColumnsAsDoublesFrom(std::istream& input,
+                                      ColumnarFormat format) {
+  return ReadSpdColumns<double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<double>>, std::string>
+ReadReflectiveSpdColumnsAsDoublesFrom(std::string_view input,
+                                      ColumnarFormat format) {
+  return ReadSpdColumns<double>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<float>>, std::string>
+ReadReflectiveSpdColumnsAsFloatsFrom(std::istream& input,
+                                     ColumnarFormat format) {
+  return ReadSpdColumns<float>(input, format);
+}
+
+std::expected<std::vector<NamedSpd<float>>, std::string>
+ReadReflectiveSpdColumnsAsFloatsFrom(std::string_view input,
+                                     ColumnarFormat format) {
+  return ReadSpdColumns<float>(input, format);
+}
+
+}  // namespace libspd
@@ -0,0 +1,77 @@
+#ifndef _LIBSPD_READERS_REFLECTIVE_SPD_COLUMNS_READER_
+#define _LIBSPD_READERS_REFLECTIVE_SPD_COLUMNS_READER_
+
+#include <concepts>
+#include <expected>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "libspd/columnar_spd_reader.h"
+#include "libspd/readers/validating_columnar_spd_reader.h"
+
+namespace libspd {
+
+// The functions below read a delimited file such as a CSV or TSV file which
+// holds many spectra side by side (see `ColumnarSpdReader`) and return one
+// spectrum for each column in the order the columns appear
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<std::vector<NamedSpd<long double>>, std::string>
+ReadReflectiveSpdColumnsAsLongDoublesFrom(
+    std::istream& input, ColumnarFormat format = ColumnarFormat());
+
+std::expected<std::vector<NamedSpd<long double>>, std::string>
+ReadReflectiveSpdColumnsAsLongDoublesFrom(
+    std::string_view input, ColumnarFormat format = ColumnarFormat());
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<std::vector<NamedSpd<double>>, std::string>
+ReadReflectiveSpdColumnsAsDoublesFrom(
+    std::istream& input, ColumnarFormat format = ColumnarFormat());
+
+std::expected<std::vector<NamedSpd<double>>, std::string>
+ReadReflectiveSpdColumnsAsDoublesFrom(
+    std::string_view input, ColumnarFormat format = ColumnarFormat());
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<std::vector<NamedSpd<float>>, std::string>
+ReadReflectiveSpdColumnsAsFloatsFrom(
+    std::istream& input, ColumnarFormat format = ColumnarFormat());
+
+std::expected<std::vector<NamedSpd<float>>, std::string>
+ReadReflectiveSpdColumnsAsFloatsFrom(
+    std::string_view input, ColumnarFormat format = ColumnarFormat());
+
+// NOTE: Behavior is undefined if input is not a binary stream
+template <std::floating_point Type>
+std::expected<std::vector<NamedSpd<Type>>, std::string>
+ReadReflectiveSpdColumnsFrom(std::istream& input,
+                             ColumnarFormat format = ColumnarFormat()) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadReflectiveSpdColumnsAsLongDoublesFrom(input, format);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadReflectiveSpdColumnsAsDoublesFrom(input, format);
+  } else {
+    return ReadReflectiveSpdColumnsAsFloatsFrom(input, format);
+  }
+}
+
+template <std::floating_point Type>
+std::expected<std::vector<NamedSpd<Type>>, std::string>
+ReadReflectiveSpdColumnsFrom(std::string_view input,
+                             ColumnarFormat format = ColumnarFormat()) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadReflectiveSpdColumnsAsLongDoublesFrom(input, format);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadReflectiveSpdColumnsAsDoublesFrom(input, format);
+  } else {
+    return ReadReflectiveSpdColumnsAsFloatsFrom(input, format);
+  }
+}
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_REFLECTIVE_SPD_COLUMNS_READER_
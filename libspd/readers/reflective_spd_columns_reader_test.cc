@@ -0,0 +1,74 @@
+#include "libspd/readers/reflective_spd_columns_reader.h"
+
+#include <fstream>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "tools/cpp/runfiles/runfiles.h"
+
+namespace libspd {
+namespace {
+
+using ::bazel::tools::cpp::runfiles::Runfiles;
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+std::ifstream OpenRunfile(const std::string& filename) {
+  std::unique_ptr<Runfiles> runfiles(Runfiles::CreateForTest());
+  std::string path = "__main__/libspd/readers/test_data/" + filename;
+  return std::ifstream(runfiles->Rlocation(path),
+                       std::ios::in | std::ios::binary);
+}
+
+TEST(ReadReflectiveSpdColumnsFrom, ReadsFloat) {
+  std::ifstream input = OpenRunfile("well_formed.csv");
+  std::vector<NamedSpd<float>> spds =
+      ReadReflectiveSpdColumnsFrom<float>(input).value();
+  ASSERT_EQ(2u, spds.size());
+  EXPECT_EQ("a", spds[0].name);
+  EXPECT_THAT(spds[0].samples, ElementsAre(Pair(1.0, 0.5), Pair(2.0, 0.25)));
+  EXPECT_EQ("b", spds[1].name);
+  EXPECT_THAT(spds[1].samples, ElementsAre(Pair(1.0, 1.0), Pair(2.0, 0.0)));
+}
+
+TEST(ReadReflectiveSpdColumnsFrom, ReadsDouble) {
+  std::ifstream input = OpenRunfile("well_formed.csv");
+  std::vector<NamedSpd<double>> spds =
+      ReadReflectiveSpdColumnsFrom<double>(input).value();
+  ASSERT_EQ(2u, spds.size());
+  EXPECT_EQ("a", spds[0].name);
+  EXPECT_THAT(spds[0].samples, ElementsAre(Pair(1.0, 0.5), Pair(2.0, 0.25)));
+  EXPECT_EQ("b", spds[1].name);
+  EXPECT_THAT(spds[1].samples, ElementsAre(Pair(1.0, 1.0), Pair(2.0, 0.0)));
+}
+
+TEST(ReadReflectiveSpdColumnsFrom, ReadsLongDouble) {
+  std::ifstream input = OpenRunfile("well_formed.csv");
+  std::vector<NamedSpd<long double>> spds =
+      ReadReflectiveSpdColumnsFrom<long double>(input).value();
+  ASSERT_EQ(2u, spds.size());
+  EXPECT_EQ("a", spds[0].name);
+  EXPECT_THAT(spds[0].samples, ElementsAre(Pair(1.0, 0.5), Pair(2.0, 0.25)));
+  EXPECT_EQ("b", spds[1].name);
+  EXPECT_THAT(spds[1].samples, ElementsAre(Pair(1.0, 1.0), Pair(2.0, 0.0)));
+}
+
+TEST(ReadReflectiveSpdColumnsFrom, ReadsTsvFromString) {
+  std::string_view input = "nm\ta\n1.0\t0.5\n";
+  ColumnarFormat format = {.delimiter = '\t'};
+  std::vector<NamedSpd<float>> spds =
+      ReadReflectiveSpdColumnsFrom<float>(input, format).value();
+  ASSERT_EQ(1u, spds.size());
+  EXPECT_EQ("a", spds[0].name);
+  EXPECT_THAT(spds[0].samples, ElementsAre(Pair(1.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdColumnsFrom, TooLarge) {
+  std::string_view input = "nm,a,b\n1.0,0.5,2.0\n";
+  EXPECT_EQ(
+      "The input contained a sample with a spectral power greater than one",
+      ReadReflectiveSpdColumnsFrom<float>(input).error());
+}
+
+}  // namespace
+}  // namespace libspd
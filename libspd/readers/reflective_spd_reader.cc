@@ -6,8 +6,9 @@
 namespace libspd {
 namespace {
 
-template <std::floating_point Type>
-class ReflectiveSpdReader final : public ValidatingSpdReader<Type> {
+template <std::floating_point Type, SpdAccumulator<Type>... Accumulators>
+class ReflectiveSpdReader final
+    : public ValidatingSpdReader<Type, Accumulators...> {
  protected:
   virtual std::expected<void, std::string> HandleComment(
       std::string_view comment) override {
@@ -16,21 +17,13 @@ class ReflectiveSpdReader final : public ValidatingSpdReader<Type> {
 
   virtual std::expected<void, std::string> HandleSample(
       std::pair<const Type, Type>& sample) override {
-    if (sample.second > static_cast<Type>(1.0)) {
-      return std::unexpected(
-          "The input contained a sample with a spectral power greater than "
-          "one");
-    }
-
-    return std::expected<void, std::string>();
+    return ValidateReflectiveSpectralPower(sample.second);
   }
 };
 
-}  // namespace
-
-std::expected<std::map<long double, long double>, std::string>
-ReadReflectiveSpdAsLongDoublesFrom(std::istream& input) {
-  ReflectiveSpdReader<long double> reader;
+template <std::floating_point Type, typename Input>
+std::expected<std::map<Type, Type>, std::string> ReadSpd(Input&& input) {
+  ReflectiveSpdReader<Type> reader;
 
   std::expected<void, std::string> result = reader.ReadFrom(input);
   if (!result) {
@@ -40,28 +33,83 @@ ReadReflectiveSpdAsLongDoublesFrom(std::istream& input) {
   return reader.Reset();
 }
 
-std::expected<std::map<double, double>, std::string>
-ReadReflectiveSpdAsDoublesFrom(std::istream& input) {
-  ReflectiveSpdReader<double> reader;
+template <std::floating_point Type, typename Input>
+std::expected<SpdWithStatistics<Type>, std::string> ReadSpdWithStatistics(
+    Input&& input) {
+  ReflectiveSpdReader<Type, SpdStatisticsAccumulator<Type>> reader;
 
   std::expected<void, std::string> result = reader.ReadFrom(input);
   if (!result) {
     return std::unexpected(std::move(result.error()));
   }
 
-  return reader.Reset();
+  SpdWithStatistics<Type> spd;
+  spd.statistics = std::get<0>(reader.GetAccumulators()).statistics();
+  spd.samples = reader.Reset();
+
+  return spd;
+}
+
+}  // namespace
+
+std::expected<std::map<long double, long double>, std::string>
+ReadReflectiveSpdAsLongDoublesFrom(std::istream& input) {
+  return ReadSpd<long double>(input);
+}
+
+std::expected<std::map<long double, long double>, std::string>
+ReadReflectiveSpdAsLongDoublesFrom(std::string_view input) {
+  return ReadSpd<long double>(input);
+}
+
+std::expected<std::map<double, double>, std::string>
+ReadReflectiveSpdAsDoublesFrom(std::istream& input) {
+  return ReadSpd<double>(input);
+}
+
+std::expected<std::map<double, double>, std::string>
+ReadReflectiveSpdAsDoublesFrom(std::string_view input) {
+  return ReadSpd<double>(input);
 }
 
 std::expected<std::map<float, float>, std::string>
 ReadReflectiveSpdAsFloatsFrom(std::istream& input) {
-  ReflectiveSpdReader<float> reader;
+  return ReadSpd<float>(input);
+}
 
-  std::expected<void, std::string> result = reader.ReadFrom(input);
-  if (!result) {
-    return std::unexpected(std::move(result.error()));
-  }
+std::expected<std::map<float, float>, std::string>
+ReadReflectiveSpdAsFloatsFrom(std::string_view input) {
+  return ReadSpd<float>(input);
+}
 
-  return reader.Reset();
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadReflectiveSpdWithStatisticsAsLongDoublesFrom(std::istream& input) {
+  return ReadSpdWithStatistics<long double>(input);
+}
+
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadReflectiveSpdWithStatisticsAsLongDoublesFrom(std::string_view input) {
+  return ReadSpdWithStatistics<long double>(input);
+}
+
+std::expected<SpdWithStatistics<double>, std::string>
+ReadReflectiveSpdWithStatisticsAsDoublesFrom(std::istream& input) {
+  return ReadSpdWithStatistics<double>(input);
+}
+
+std::expected<SpdWithStatistics<double>, std::string>
+ReadReflectiveSpdWithStatisticsAsDoublesFrom(std::string_view input) {
+  return ReadSpdWithStatistics<double>(input);
+}
+
+std::expected<SpdWithStatistics<float>, std::string>
+ReadReflectiveSpdWithStatisticsAsFloatsFrom(std::istream& input) {
+  return ReadSpdWithStatistics<float>(input);
+}
+
+std::expected<SpdWithStatistics<float>, std::string>
+ReadReflectiveSpdWithStatisticsAsFloatsFrom(std::string_view input) {
+  return ReadSpdWithStatistics<float>(input);
 }
 
 }  // namespace libspd
\ No newline at end of file
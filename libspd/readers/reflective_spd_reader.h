@@ -6,10 +6,26 @@
 #include <istream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
+#include "libspd/readers/spd_accumulators.h"
+
 namespace libspd {
 
+// The validation performed by the reflective readers in addition to that of
+// `ValidatingSpdReader`
+template <std::floating_point Type>
+constexpr std::expected<void, std::string> ValidateReflectiveSpectralPower(
+    Type spectral_power) {
+  if (spectral_power > static_cast<Type>(1.0)) {
+    return std::unexpected(
+        "The input contained a sample with a spectral power greater than one");
+  }
+
+  return std::expected<void, std::string>();
+}
+
 // NOTE: Behavior is undefined if input is not a binary stream
 std::expected<std::map<long double, long double>, std::string>
 ReadReflectiveSpdAsLongDoublesFrom(std::istream& input);
@@ -22,6 +38,39 @@ ReadReflectiveSpdAsDoublesFrom(std::istream& input);
 std::expected<std::map<float, float>, std::string>
 ReadReflectiveSpdAsFloatsFrom(std::istream& input);
 
+std::expected<std::map<long double, long double>, std::string>
+ReadReflectiveSpdAsLongDoublesFrom(std::string_view input);
+
+std::expected<std::map<double, double>, std::string>
+ReadReflectiveSpdAsDoublesFrom(std::string_view input);
+
+std::expected<std::map<float, float>, std::string>
+ReadReflectiveSpdAsFloatsFrom(std::string_view input);
+
+// The functions below additionally return statistics about the samples which
+// are computed while the input is parsed
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadReflectiveSpdWithStatisticsAsLongDoublesFrom(std::istream& input);
+
+std::expected<SpdWithStatistics<long double>, std::string>
+ReadReflectiveSpdWithStatisticsAsLongDoublesFrom(std::string_view input);
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<SpdWithStatistics<double>, std::string>
+ReadReflectiveSpdWithStatisticsAsDoublesFrom(std::istream& input);
+
+std::expected<SpdWithStatistics<double>, std::string>
+ReadReflectiveSpdWithStatisticsAsDoublesFrom(std::string_view input);
+
+// NOTE: Behavior is undefined if input is not a binary stream
+std::expected<SpdWithStatistics<float>, std::string>
+ReadReflectiveSpdWithStatisticsAsFloatsFrom(std::istream& input);
+
+std::expected<SpdWithStatistics<float>, std::string>
+ReadReflectiveSpdWithStatisticsAsFloatsFrom(std::string_view input);
+
 // NOTE: Behavior is undefined if input is not a binary stream
 template <std::floating_point Type>
 std::expected<std::map<Type, Type>, std::string> ReadReflectiveSpdFrom(
@@ -35,6 +84,43 @@ std::expected<std::map<Type, Type>, std::string> ReadReflectiveSpdFrom(
   }
 }
 
+template <std::floating_point Type>
+std::expected<std::map<Type, Type>, std::string> ReadReflectiveSpdFrom(
+    std::string_view input) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadReflectiveSpdAsLongDoublesFrom(input);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadReflectiveSpdAsDoublesFrom(input);
+  } else {
+    return ReadReflectiveSpdAsFloatsFrom(input);
+  }
+}
+
+// NOTE: Behavior is undefined if input is not a binary stream
+template <std::floating_point Type>
+std::expected<SpdWithStatistics<Type>, std::string>
+ReadReflectiveSpdWithStatisticsFrom(std::istream& input) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadReflectiveSpdWithStatisticsAsLongDoublesFrom(input);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadReflectiveSpdWithStatisticsAsDoublesFrom(input);
+  } else {
+    return ReadReflectiveSpdWithStatisticsAsFloatsFrom(input);
+  }
+}
+
+template <std::floating_point Type>
+std::expected<SpdWithStatistics<Type>, std::string>
+ReadReflectiveSpdWithStatisticsFrom(std::string_view input) {
+  if constexpr (std::is_same<long double, Type>()) {
+    return ReadReflectiveSpdWithStatisticsAsLongDoublesFrom(input);
+  } else if constexpr (std::is_same<double, Type>()) {
+    return ReadReflectiveSpdWithStatisticsAsDoublesFrom(input);
+  } else {
+    return ReadReflectiveSpdWithStatisticsAsFloatsFrom(input);
+  }
+}
+
 }  // namespace libspd
 
 #endif  // _LIBSPD_READERS_REFLECTIVE_SPD_READER_
\ No newline at end of file
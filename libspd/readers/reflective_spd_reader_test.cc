@@ -59,5 +59,84 @@ TEST(ReadReflectiveSpdFrom, ReadsLongDouble) {
               ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
 }
 
+TEST(ReadReflectiveSpdFrom, ReadsFloatFromString) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  EXPECT_THAT(ReadReflectiveSpdFrom<float>(input).value(),
+              ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdFrom, ReadsDoubleFromString) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  EXPECT_THAT(ReadReflectiveSpdFrom<double>(input).value(),
+              ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdFrom, ReadsLongDoubleFromString) {
+  std::string_view input = "1.0 1.0\n5.0 0.5\n3.0 0.0";
+  EXPECT_THAT(ReadReflectiveSpdFrom<long double>(input).value(),
+              ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+}
+
+TEST(ReadReflectiveSpdFrom, TooLargeFromString) {
+  EXPECT_EQ(
+      "The input contained a sample with a spectral power greater than one",
+      ReadReflectiveSpdFrom<float>(std::string_view("1.0 2.0")).error());
+}
+
+TEST(ReadReflectiveSpdWithStatisticsFrom, ReadsFloat) {
+  std::ifstream input = OpenRunfile("well_formed_reflective.spd");
+  auto result = ReadReflectiveSpdWithStatisticsFrom<float>(input).value();
+  EXPECT_THAT(result.samples,
+              ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+  EXPECT_EQ(3u, result.statistics.num_samples);
+  EXPECT_EQ(1.0, result.statistics.min_wavelength);
+  EXPECT_EQ(5.0, result.statistics.max_wavelength);
+  EXPECT_EQ(1.0, result.statistics.peak_spectral_power);
+  EXPECT_EQ(1.0, result.statistics.peak_wavelength);
+  EXPECT_EQ(1.5, result.statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, result.statistics.min_sample_spacing);
+  EXPECT_TRUE(result.statistics.uniformly_spaced);
+  EXPECT_FALSE(result.statistics.monotonic);
+}
+
+TEST(ReadReflectiveSpdWithStatisticsFrom, ReadsDouble) {
+  std::ifstream input = OpenRunfile("well_formed_reflective.spd");
+  auto result = ReadReflectiveSpdWithStatisticsFrom<double>(input).value();
+  EXPECT_THAT(result.samples,
+              ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+  EXPECT_EQ(3u, result.statistics.num_samples);
+  EXPECT_EQ(1.0, result.statistics.min_wavelength);
+  EXPECT_EQ(5.0, result.statistics.max_wavelength);
+  EXPECT_EQ(1.0, result.statistics.peak_spectral_power);
+  EXPECT_EQ(1.0, result.statistics.peak_wavelength);
+  EXPECT_EQ(1.5, result.statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, result.statistics.min_sample_spacing);
+  EXPECT_TRUE(result.statistics.uniformly_spaced);
+  EXPECT_FALSE(result.statistics.monotonic);
+}
+
+TEST(ReadReflectiveSpdWithStatisticsFrom, ReadsLongDouble) {
+  std::ifstream input = OpenRunfile("well_formed_reflective.spd");
+  auto result = ReadReflectiveSpdWithStatisticsFrom<long double>(input).value();
+  EXPECT_THAT(result.samples,
+              ElementsAre(Pair(1.0, 1.0), Pair(3.0, 0.0), Pair(5.0, 0.5)));
+  EXPECT_EQ(3u, result.statistics.num_samples);
+  EXPECT_EQ(1.0, result.statistics.min_wavelength);
+  EXPECT_EQ(5.0, result.statistics.max_wavelength);
+  EXPECT_EQ(1.0, result.statistics.peak_spectral_power);
+  EXPECT_EQ(1.0, result.statistics.peak_wavelength);
+  EXPECT_EQ(1.5, result.statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, result.statistics.min_sample_spacing);
+  EXPECT_TRUE(result.statistics.uniformly_spaced);
+  EXPECT_FALSE(result.statistics.monotonic);
+}
+
+TEST(ReadReflectiveSpdWithStatisticsFrom, TooLarge) {
+  std::ifstream input = OpenRunfile("well_formed.spd");
+  EXPECT_EQ(
+      "The input contained a sample with a spectral power greater than one",
+      ReadReflectiveSpdWithStatisticsFrom<float>(input).error());
+}
+
 }  // namespace
 }  // namespace libspd
\ No newline at end of file
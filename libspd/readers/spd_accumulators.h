@@ -0,0 +1,264 @@
+#ifndef _LIBSPD_READERS_SPD_ACCUMULATORS_
+#define _LIBSPD_READERS_SPD_ACCUMULATORS_
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <map>
+
+namespace libspd {
+
+// Statistics computed over the samples of an SPD file while it is parsed. All
+// values are zero if the file contained no samples.
+template <std::floating_point Type>
+struct SpdStatistics {
+  size_t num_samples = 0;
+  Type min_wavelength = 0.0;
+  Type max_wavelength = 0.0;
+  Type peak_spectral_power = 0.0;
+  Type peak_wavelength = 0.0;
+  Type integrated_spectral_power = 0.0;
+  Type min_sample_spacing = 0.0;
+  bool uniformly_spaced = true;
+  bool monotonic = true;
+};
+
+template <std::floating_point Type>
+struct SpdWithStatistics {
+  std::map<Type, Type> samples;
+  SpdStatistics<Type> statistics;
+};
+
+// Tracks the smallest and largest wavelengths sampled
+template <std::floating_point Type>
+class WavelengthRangeAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    min_wavelength_ = samples.begin()->first;
+    max_wavelength_ = samples.rbegin()->first;
+  }
+
+  Type min_wavelength() const { return min_wavelength_; }
+  Type max_wavelength() const { return max_wavelength_; }
+
+ private:
+  Type min_wavelength_ = 0.0;
+  Type max_wavelength_ = 0.0;
+};
+
+// Tracks the largest spectral power sampled and the wavelength at which it
+// first occurred in the input
+template <std::floating_point Type>
+class PeakSpectralPowerAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    if (samples.size() == 1 || peak_spectral_power_ < sample->second) {
+      peak_wavelength_ = sample->first;
+      peak_spectral_power_ = sample->second;
+    }
+  }
+
+  Type peak_spectral_power() const { return peak_spectral_power_; }
+  Type peak_wavelength() const { return peak_wavelength_; }
+
+ private:
+  Type peak_spectral_power_ = 0.0;
+  Type peak_wavelength_ = 0.0;
+};
+
+// Integrates the piecewise linear spectrum defined by the samples using the
+// trapezoidal rule. Samples are not required to arrive in order; a sample that
+// lands between two existing samples replaces the trapezoid spanning them.
+template <std::floating_point Type>
+class IntegratedSpectralPowerAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    auto upper = std::next(sample);
+    if (upper != samples.end()) {
+      integral_ += Trapezoid(*sample, *upper);
+    }
+
+    if (sample != samples.begin()) {
+      auto lower = std::prev(sample);
+      integral_ += Trapezoid(*lower, *sample);
+      if (upper != samples.end()) {
+        integral_ -= Trapezoid(*lower, *upper);
+      }
+    }
+  }
+
+  Type integrated_spectral_power() const {
+    return static_cast<Type>(integral_);
+  }
+
+ private:
+  static long double Trapezoid(const std::pair<const Type, Type>& lower,
+                               const std::pair<const Type, Type>& upper) {
+    return (static_cast<long double>(upper.first) - lower.first) *
+           (static_cast<long double>(lower.second) + upper.second) * 0.5L;
+  }
+
+  long double integral_ = 0.0;
+};
+
+// Tracks the smallest and largest distances between two adjacent wavelengths
+// and whether the samples are evenly spaced, which is the case when those two
+// distances are equal up to rounding. Only a constant amount of state is kept
+// regardless of the number of samples.
+template <std::floating_point Type>
+class SampleSpacingAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    auto upper = std::next(sample);
+    if (upper != samples.end()) {
+      AddSpacing(upper->first - sample->first);
+    }
+
+    if (sample != samples.begin()) {
+      auto lower = std::prev(sample);
+      AddSpacing(sample->first - lower->first);
+
+      // A sample inserted between two others splits the gap between them
+      if (upper != samples.end()) {
+        RemoveSpacing(upper->first - lower->first);
+      }
+    }
+
+    num_samples_ = samples.size();
+    min_wavelength_ = samples.begin()->first;
+    max_wavelength_ = samples.rbegin()->first;
+  }
+
+  // Returns zero if fewer than two samples were seen
+  Type min_sample_spacing() const { return min_spacing_; }
+
+  // Returns zero if fewer than two samples were seen. If a sample was inserted
+  // into the only gap of the largest size seen, the largest remaining gap is
+  // not known and an upper bound computed from the range of wavelengths and
+  // the smallest gap is returned instead.
+  Type max_sample_spacing() const {
+    if (max_spacing_exact_) {
+      return max_spacing_;
+    }
+
+    // Every gap other than the largest is at least the smallest gap
+    Type bound = (max_wavelength_ - min_wavelength_) -
+                 static_cast<Type>(num_samples_ - 2) * min_spacing_;
+    return (bound < max_spacing_) ? bound : max_spacing_;
+  }
+
+  // Returns true if every pair of adjacent samples is separated by the same
+  // distance, within a tolerance that covers the rounding of the wavelengths
+  // bounding a single gap. Out of order input for which `max_sample_spacing`
+  // is only an upper bound may be reported as not uniformly spaced if its
+  // spacing is uniform only up to rounding.
+  bool uniformly_spaced() const {
+    Type tolerance = static_cast<Type>(kToleranceUlps) * max_wavelength_ *
+                     std::numeric_limits<Type>::epsilon();
+    return max_sample_spacing() - min_sample_spacing() <= tolerance;
+  }
+
+ private:
+  static constexpr int kToleranceUlps = 4;
+
+  void AddSpacing(Type spacing) {
+    if (num_spacings_ == 0 || spacing < min_spacing_) {
+      min_spacing_ = spacing;
+    }
+
+    if (num_spacings_ == 0 || max_spacing_ < spacing) {
+      max_spacing_ = spacing;
+      num_max_spacings_ = 1;
+      max_spacing_exact_ = true;
+    } else if (spacing == max_spacing_) {
+      // If `max_spacing_` was only an upper bound, it is now reached
+      num_max_spacings_ = max_spacing_exact_ ? num_max_spacings_ + 1 : 1;
+      max_spacing_exact_ = true;
+    }
+
+    num_spacings_ += 1;
+  }
+
+  // The smallest spacing is unaffected since the removed gap is always
+  // replaced by two smaller ones
+  void RemoveSpacing(Type spacing) {
+    if (max_spacing_exact_ && spacing == max_spacing_) {
+      num_max_spacings_ -= 1;
+      max_spacing_exact_ = num_max_spacings_ != 0;
+    }
+
+    num_spacings_ -= 1;
+  }
+
+  size_t num_samples_ = 0;
+  size_t num_spacings_ = 0;
+  size_t num_max_spacings_ = 0;
+  Type min_spacing_ = 0.0;
+  Type max_spacing_ = 0.0;
+  bool max_spacing_exact_ = true;
+  Type min_wavelength_ = 0.0;
+  Type max_wavelength_ = 0.0;
+};
+
+// Tracks whether the samples appeared in the input in order of strictly
+// increasing wavelength
+template <std::floating_point Type>
+class MonotonicityAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    monotonic_ = monotonic_ && std::next(sample) == samples.end();
+  }
+
+  bool monotonic() const { return monotonic_; }
+
+ private:
+  bool monotonic_ = true;
+};
+
+// Combines the accumulators above in order to compute `SpdStatistics`
+template <std::floating_point Type>
+class SpdStatisticsAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    num_samples_ = samples.size();
+    wavelength_range_.Accumulate(samples, sample);
+    peak_spectral_power_.Accumulate(samples, sample);
+    integrated_spectral_power_.Accumulate(samples, sample);
+    sample_spacing_.Accumulate(samples, sample);
+    monotonicity_.Accumulate(samples, sample);
+  }
+
+  SpdStatistics<Type> statistics() const {
+    SpdStatistics<Type> result;
+    result.num_samples = num_samples_;
+    result.min_wavelength = wavelength_range_.min_wavelength();
+    result.max_wavelength = wavelength_range_.max_wavelength();
+    result.peak_spectral_power = peak_spectral_power_.peak_spectral_power();
+    result.peak_wavelength = peak_spectral_power_.peak_wavelength();
+    result.integrated_spectral_power =
+        integrated_spectral_power_.integrated_spectral_power();
+    result.min_sample_spacing = sample_spacing_.min_sample_spacing();
+    result.uniformly_spaced = sample_spacing_.uniformly_spaced();
+    result.monotonic = monotonicity_.monotonic();
+    return result;
+  }
+
+ private:
+  size_t num_samples_ = 0;
+  WavelengthRangeAccumulator<Type> wavelength_range_;
+  PeakSpectralPowerAccumulator<Type> peak_spectral_power_;
+  IntegratedSpectralPowerAccumulator<Type> integrated_spectral_power_;
+  SampleSpacingAccumulator<Type> sample_spacing_;
+  MonotonicityAccumulator<Type> monotonicity_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_SPD_ACCUMULATORS_
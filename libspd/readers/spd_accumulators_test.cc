@@ -0,0 +1,203 @@
+#include "libspd/readers/spd_accumulators.h"
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/readers/allocation_counter.h"
+#include "libspd/readers/validating_spd_reader.h"
+
+namespace libspd {
+namespace {
+
+template <std::floating_point Type, SpdAccumulator<Type>... Accumulators>
+class TestSpdReader final : public ValidatingSpdReader<Type, Accumulators...> {
+ protected:
+  std::expected<void, std::string> HandleComment(
+      std::string_view comment) override {
+    return std::expected<void, std::string>();
+  }
+
+  std::expected<void, std::string> HandleSample(
+      std::pair<const Type, Type>& sample) override {
+    return std::expected<void, std::string>();
+  }
+};
+
+template <typename Accumulator, std::floating_point Type = double>
+Accumulator Accumulate(std::string_view input) {
+  TestSpdReader<Type, Accumulator> reader;
+  EXPECT_TRUE(reader.ReadFrom(input));
+  return std::get<0>(reader.GetAccumulators());
+}
+
+TEST(WavelengthRangeAccumulator, Empty) {
+  auto accumulator = Accumulate<WavelengthRangeAccumulator<double>>("");
+  EXPECT_EQ(0.0, accumulator.min_wavelength());
+  EXPECT_EQ(0.0, accumulator.max_wavelength());
+}
+
+TEST(WavelengthRangeAccumulator, Unordered) {
+  auto accumulator = Accumulate<WavelengthRangeAccumulator<double>>(
+      "3.0 1.0 1.0 1.0 5.0 1.0 2.0 1.0");
+  EXPECT_EQ(1.0, accumulator.min_wavelength());
+  EXPECT_EQ(5.0, accumulator.max_wavelength());
+}
+
+TEST(PeakSpectralPowerAccumulator, Empty) {
+  auto accumulator = Accumulate<PeakSpectralPowerAccumulator<double>>("");
+  EXPECT_EQ(0.0, accumulator.peak_spectral_power());
+  EXPECT_EQ(0.0, accumulator.peak_wavelength());
+}
+
+TEST(PeakSpectralPowerAccumulator, FirstPeakWins) {
+  auto accumulator = Accumulate<PeakSpectralPowerAccumulator<double>>(
+      "3.0 1.0 1.0 4.0 5.0 2.0 2.0 4.0");
+  EXPECT_EQ(4.0, accumulator.peak_spectral_power());
+  EXPECT_EQ(1.0, accumulator.peak_wavelength());
+}
+
+TEST(IntegratedSpectralPowerAccumulator, Empty) {
+  auto accumulator =
+      Accumulate<IntegratedSpectralPowerAccumulator<double>>("");
+  EXPECT_EQ(0.0, accumulator.integrated_spectral_power());
+}
+
+TEST(IntegratedSpectralPowerAccumulator, Ordered) {
+  auto accumulator = Accumulate<IntegratedSpectralPowerAccumulator<double>>(
+      "1.0 1.0 2.0 3.0 4.0 3.0");
+  EXPECT_EQ(8.0, accumulator.integrated_spectral_power());
+}
+
+TEST(IntegratedSpectralPowerAccumulator, Unordered) {
+  auto accumulator = Accumulate<IntegratedSpectralPowerAccumulator<double>>(
+      "2.0 3.0 4.0 3.0 1.0 1.0");
+  EXPECT_EQ(8.0, accumulator.integrated_spectral_power());
+
+  accumulator = Accumulate<IntegratedSpectralPowerAccumulator<double>>(
+      "1.0 1.0 4.0 3.0 2.0 3.0");
+  EXPECT_EQ(8.0, accumulator.integrated_spectral_power());
+}
+
+TEST(SampleSpacingAccumulator, Empty) {
+  auto accumulator = Accumulate<SampleSpacingAccumulator<double>>("");
+  EXPECT_EQ(0.0, accumulator.min_sample_spacing());
+  EXPECT_TRUE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, Uniform) {
+  auto accumulator = Accumulate<SampleSpacingAccumulator<double>>(
+      "400.0 1.0 410.0 1.0 390.0 1.0 420.0 1.0");
+  EXPECT_EQ(10.0, accumulator.min_sample_spacing());
+  EXPECT_TRUE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, NonUniform) {
+  auto accumulator = Accumulate<SampleSpacingAccumulator<double>>(
+      "400.0 1.0 410.0 1.0 415.0 1.0 430.0 1.0");
+  EXPECT_EQ(5.0, accumulator.min_sample_spacing());
+  EXPECT_FALSE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, NonUniformSplit) {
+  auto accumulator = Accumulate<SampleSpacingAccumulator<double>>(
+      "400.0 1.0 420.0 1.0 430.0 1.0 410.0 1.0");
+  EXPECT_EQ(10.0, accumulator.min_sample_spacing());
+  EXPECT_EQ(10.0, accumulator.max_sample_spacing());
+  EXPECT_TRUE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, UniformWithRounding) {
+  std::string input;
+  for (int i = 0; i < 3000; i++) {
+    input += std::to_string(380.1 + 0.1 * i) + " 1.0\n";
+  }
+
+  auto accumulator = Accumulate<SampleSpacingAccumulator<float>, float>(input);
+  EXPECT_TRUE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, SingleGapInLargeInput) {
+  std::string input;
+  for (int i = 0; i < 3001; i++) {
+    if (i != 1500) {
+      input += std::to_string(380 + i) + ".0 1.0\n";
+    }
+  }
+
+  auto accumulator = Accumulate<SampleSpacingAccumulator<float>, float>(input);
+  EXPECT_EQ(1.0f, accumulator.min_sample_spacing());
+  EXPECT_EQ(2.0f, accumulator.max_sample_spacing());
+  EXPECT_FALSE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, NonUniformSplitOfLargestGap) {
+  auto accumulator = Accumulate<SampleSpacingAccumulator<double>>(
+      "400.0 1.0 430.0 1.0 410.0 1.0");
+  EXPECT_EQ(10.0, accumulator.min_sample_spacing());
+  EXPECT_EQ(20.0, accumulator.max_sample_spacing());
+  EXPECT_FALSE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, Descending) {
+  std::string input;
+  for (int i = 3000; i >= 0; i--) {
+    input += std::to_string(380 + i) + ".0 1.0\n";
+  }
+
+  auto accumulator = Accumulate<SampleSpacingAccumulator<float>, float>(input);
+  EXPECT_EQ(1.0f, accumulator.min_sample_spacing());
+  EXPECT_EQ(1.0f, accumulator.max_sample_spacing());
+  EXPECT_TRUE(accumulator.uniformly_spaced());
+}
+
+TEST(SampleSpacingAccumulator, DoesNotAllocate) {
+  std::string input;
+  for (int i = 0; i < 1000; i++) {
+    input += std::to_string(380 + i) + ".0 1.0\n";
+  }
+
+  size_t allocations = NumAllocations();
+  Accumulate<WavelengthRangeAccumulator<float>, float>(input);
+  size_t baseline = NumAllocations() - allocations;
+
+  allocations = NumAllocations();
+  Accumulate<SampleSpacingAccumulator<float>, float>(input);
+  EXPECT_EQ(baseline, NumAllocations() - allocations);
+}
+
+TEST(MonotonicityAccumulator, Monotonic) {
+  auto accumulator =
+      Accumulate<MonotonicityAccumulator<double>>("1.0 1.0 2.0 1.0 3.0 1.0");
+  EXPECT_TRUE(accumulator.monotonic());
+}
+
+TEST(MonotonicityAccumulator, NotMonotonic) {
+  auto accumulator =
+      Accumulate<MonotonicityAccumulator<double>>("1.0 1.0 3.0 1.0 2.0 1.0");
+  EXPECT_FALSE(accumulator.monotonic());
+}
+
+TEST(SpdStatisticsAccumulator, Statistics) {
+  SpdStatistics<double> statistics =
+      Accumulate<SpdStatisticsAccumulator<double>>("1.0 2.0 5.0 6.0 3.0 4.0")
+          .statistics();
+  EXPECT_EQ(3u, statistics.num_samples);
+  EXPECT_EQ(1.0, statistics.min_wavelength);
+  EXPECT_EQ(5.0, statistics.max_wavelength);
+  EXPECT_EQ(6.0, statistics.peak_spectral_power);
+  EXPECT_EQ(5.0, statistics.peak_wavelength);
+  EXPECT_EQ(16.0, statistics.integrated_spectral_power);
+  EXPECT_EQ(2.0, statistics.min_sample_spacing);
+  EXPECT_TRUE(statistics.uniformly_spaced);
+  EXPECT_FALSE(statistics.monotonic);
+}
+
+TEST(SpdStatisticsAccumulator, ResetClearsStatistics) {
+  TestSpdReader<double, SpdStatisticsAccumulator<double>> reader;
+  EXPECT_TRUE(reader.ReadFrom(std::string_view("1.0 2.0")));
+  EXPECT_EQ(1u, std::get<0>(reader.GetAccumulators()).statistics().num_samples);
+  reader.Reset();
+  EXPECT_EQ(0u, std::get<0>(reader.GetAccumulators()).statistics().num_samples);
+}
+
+}  // namespace
+}  // namespace libspd
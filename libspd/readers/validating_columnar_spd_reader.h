@@ -0,0 +1,111 @@
+#ifndef _LIBSPD_READERS_VALIDATING_COLUMNAR_SPD_READER_
+#define _LIBSPD_READERS_VALIDATING_COLUMNAR_SPD_READER_
+
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "libspd/columnar_spd_reader.h"
+#include "libspd/readers/validating_spd_reader.h"
+
+namespace libspd {
+
+// The samples of one column of a delimited file along with its name
+template <std::floating_point Type>
+struct NamedSpd {
+  std::string name;
+  std::map<Type, Type> samples;
+};
+
+// Reads each spectrum column of a delimited file into its own map. Every
+// sample passes through a `ValidatingSpdReader` for its column and so is
+// subject to exactly the same validation, and computes the same accumulators,
+// as a sample read from an SPD file.
+template <std::floating_point Type, SpdAccumulator<Type>... Accumulators>
+class ValidatingColumnarSpdReader : public ColumnarSpdReader {
+ public:
+  using ColumnarSpdReader::ColumnarSpdReader;
+
+  // Returns the spectra in the order their columns appear in the input
+  std::vector<NamedSpd<Type>> Reset() {
+    std::vector<NamedSpd<Type>> result;
+    result.reserve(columns_.size());
+    for (Column& column : columns_) {
+      result.emplace_back(std::move(column.name), column.Reset());
+    }
+
+    columns_.clear();
+
+    return result;
+  }
+
+  // NOTE: Must be called before `Reset` which also resets the accumulators.
+  // Behavior is undefined if column is out of range.
+  const std::tuple<Accumulators...>& GetAccumulators(size_t column) const {
+    return columns_[column].GetAccumulators();
+  }
+
+ protected:
+  virtual std::expected<void, std::string> HandleSample(
+      size_t column, std::pair<const Type, Type>& sample) = 0;
+
+  std::expected<void, std::string> HandleColumns(
+      std::span<const std::string_view> names) final override {
+    columns_.clear();
+    columns_.reserve(names.size());
+    for (size_t column = 0; column < names.size(); column++) {
+      columns_.emplace_back(*this, column, std::string(names[column]));
+    }
+
+    return std::expected<void, std::string>();
+  }
+
+  std::expected<void, std::string> HandleSample(
+      size_t column, long double wavelength,
+      long double spectral_power) final override {
+    return columns_[column].Add(wavelength, spectral_power);
+  }
+
+ private:
+  class Column final : public ValidatingSpdReader<Type, Accumulators...> {
+   public:
+    Column(ValidatingColumnarSpdReader& owner, size_t index, std::string name)
+        : name(std::move(name)), owner_(&owner), index_(index) {}
+
+    std::expected<void, std::string> Add(long double wavelength,
+                                         long double spectral_power) {
+      return ValidatingSpdReader<Type, Accumulators...>::HandleSample(
+          wavelength, spectral_power);
+    }
+
+    std::string name;
+
+   protected:
+    std::expected<void, std::string> HandleComment(
+        std::string_view comment) override {
+      return std::expected<void, std::string>();
+    }
+
+    std::expected<void, std::string> HandleSample(
+        std::pair<const Type, Type>& sample) override {
+      return owner_->HandleSample(index_, sample);
+    }
+
+   private:
+    ValidatingColumnarSpdReader* owner_;
+    size_t index_;
+  };
+
+  std::vector<Column> columns_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_READERS_VALIDATING_COLUMNAR_SPD_READER_
@@ -0,0 +1,111 @@
+#include "libspd/readers/validating_columnar_spd_reader.h"
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/readers/spd_accumulators.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+using ::testing::Return;
+
+class MockValidatingColumnarSpdReader final
+    : public ValidatingColumnarSpdReader<float> {
+ public:
+  using ValidatingColumnarSpdReader<float>::ValidatingColumnarSpdReader;
+
+  MOCK_METHOD((std::expected<void, std::string>), HandleSample,
+              (size_t, (std::pair<const float, float>)&), (override));
+};
+
+class AcceptingColumnarSpdReader final
+    : public ValidatingColumnarSpdReader<float,
+                                         SpdStatisticsAccumulator<float>> {
+ protected:
+  std::expected<void, std::string> HandleSample(
+      size_t column, std::pair<const float, float>& sample) override {
+    return std::expected<void, std::string>();
+  }
+};
+
+TEST(ValidatingColumnarSpdReader, Nothing) {
+  MockValidatingColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleSample(_, _)).Times(0);
+  EXPECT_THAT(reader.Reset(), IsEmpty());
+}
+
+TEST(ValidatingColumnarSpdReader, SplitsColumns) {
+  std::string_view input =
+      "nm,a,b\n"
+      "3.0,4.0,\n"
+      "1.0,2.0,5.0\n";
+
+  MockValidatingColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleSample(0, Pair(3.0, 4.0)))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(0, Pair(1.0, 2.0)))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(reader, HandleSample(1, Pair(1.0, 5.0)))
+      .WillOnce(Return(std::expected<void, std::string>()));
+
+  ASSERT_TRUE(reader.ReadFrom(input));
+  EXPECT_THAT(
+      reader.Reset(),
+      ElementsAre(
+          AllOf(Field(&NamedSpd<float>::name, "a"),
+                Field(&NamedSpd<float>::samples,
+                      ElementsAre(Pair(1.0, 2.0), Pair(3.0, 4.0)))),
+          AllOf(Field(&NamedSpd<float>::name, "b"),
+                Field(&NamedSpd<float>::samples,
+                      ElementsAre(Pair(1.0, 5.0))))));
+}
+
+TEST(ValidatingColumnarSpdReader, ReturnsSampleError) {
+  MockValidatingColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleSample(0, Pair(1.0, 2.0)))
+      .WillOnce(Return(std::unexpected("error")));
+  std::string_view input = "nm,a\n1.0,2.0";
+  EXPECT_EQ("error", reader.ReadFrom(input).error());
+}
+
+TEST(ValidatingColumnarSpdReader, NegativePower) {
+  MockValidatingColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleSample(_, _)).Times(0);
+  EXPECT_EQ("The input contained a sample with a negative spectral power",
+            reader.ReadFrom(std::string_view("nm,a\n1.0,-2.0")).error());
+}
+
+TEST(ValidatingColumnarSpdReader, DuplicateWavelength) {
+  MockValidatingColumnarSpdReader reader;
+  EXPECT_CALL(reader, HandleSample(0, Pair(1.0, 2.0)))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_EQ("The input contained multiple samples with the same wavelength",
+            reader.ReadFrom(std::string_view("nm,a\n1.0,2.0\n1.0,3.0"))
+                .error());
+}
+
+TEST(ValidatingColumnarSpdReader, Accumulators) {
+  std::string_view input =
+      "nm,a,b\n"
+      "1.0,2.0,5.0\n"
+      "3.0,4.0,1.0\n";
+
+  AcceptingColumnarSpdReader reader;
+  ASSERT_TRUE(reader.ReadFrom(input));
+
+  SpdStatistics<float> a = std::get<0>(reader.GetAccumulators(0)).statistics();
+  EXPECT_EQ(2u, a.num_samples);
+  EXPECT_EQ(4.0f, a.peak_spectral_power);
+
+  SpdStatistics<float> b = std::get<0>(reader.GetAccumulators(1)).statistics();
+  EXPECT_EQ(2u, b.num_samples);
+  EXPECT_EQ(5.0f, b.peak_spectral_power);
+}
+
+}  // namespace
+}  // namespace libspd
@@ -3,64 +3,111 @@
 
 #include <cmath>
 #include <concepts>
+#include <limits>
 #include <map>
+#include <string>
+#include <tuple>
+#include <utility>
 
 #include "libspd/spd_reader.h"
 
 namespace libspd {
 
+// Validates that a sample is well formed and converts it into the requested
+// precision. This is the validation performed by `ValidatingSpdReader` with the
+// exception of checking for duplicate wavelengths.
 template <std::floating_point Type>
+constexpr std::expected<std::pair<Type, Type>, std::string> ValidateSample(
+    long double wavelength, long double spectral_power) {
+  if (wavelength < static_cast<long double>(0.0)) {
+    return std::unexpected(
+        "The input contained a sample with a negative wavelength");
+  }
+
+  if (spectral_power < static_cast<long double>(0.0)) {
+    return std::unexpected(
+        "The input contained a sample with a negative spectral power");
+  }
+
+  Type wavelength_final_precision = static_cast<Type>(wavelength);
+  if (wavelength_final_precision == static_cast<Type>(0.0)) {
+    return std::unexpected(
+        "The input contained a sample with a wavelength of zero");
+  }
+
+  if (!(std::abs(wavelength_final_precision) <=
+        std::numeric_limits<Type>::max())) {
+    return std::unexpected(
+        "The input contained a sample with a non-finite wavelength");
+  }
+
+  Type spectral_power_final_precision = static_cast<Type>(spectral_power);
+  if (!(std::abs(spectral_power_final_precision) <=
+        std::numeric_limits<Type>::max())) {
+    return std::unexpected(
+        "The input contained a sample with a non-finite spectral power");
+  }
+
+  return std::make_pair(wavelength_final_precision,
+                        spectral_power_final_precision);
+}
+
+// An accumulator computes a reduction over the samples of an SPD file while it
+// is being parsed. `Accumulate` is called once for each sample after it has
+// been validated and inserted into `samples`, with `sample` pointing to the
+// newly inserted sample.
+template <typename Accumulator, typename Type>
+concept SpdAccumulator =
+    std::default_initializable<Accumulator> &&
+    requires(Accumulator accumulator, const std::map<Type, Type>& samples,
+             typename std::map<Type, Type>::const_iterator sample) {
+      accumulator.Accumulate(samples, sample);
+    };
+
+template <std::floating_point Type, SpdAccumulator<Type>... Accumulators>
 class ValidatingSpdReader : public SpdReader {
  private:
   std::map<Type, Type> samples_;
+  std::tuple<Accumulators...> accumulators_;
 
  public:
   std::map<Type, Type> Reset() {
     std::map<Type, Type> result = std::move(samples_);
     samples_.clear();
+    accumulators_ = std::tuple<Accumulators...>();
     return result;
   }
 
+  // NOTE: Must be called before `Reset` which also resets the accumulators
+  const std::tuple<Accumulators...>& GetAccumulators() const {
+    return accumulators_;
+  }
+
  protected:
   virtual std::expected<void, std::string> HandleSample(
       std::pair<const Type, Type>& sample) = 0;
 
   std::expected<void, std::string> HandleSample(
       long double wavelength, long double spectral_power) final override {
-    if (wavelength < static_cast<long double>(0.0)) {
-      return std::unexpected(
-          "The input contained a sample with a negative wavelength");
-    }
-
-    if (spectral_power < static_cast<long double>(0.0)) {
-      return std::unexpected(
-          "The input contained a sample with a negative spectral power");
-    }
-
-    Type wavelength_final_precision = static_cast<Type>(wavelength);
-    if (wavelength_final_precision == static_cast<Type>(0.0)) {
-      return std::unexpected(
-          "The input contained a sample with a wavelength of zero");
+    std::expected<std::pair<Type, Type>, std::string> sample =
+        ValidateSample<Type>(wavelength, spectral_power);
+    if (!sample) {
+      return std::unexpected(std::move(sample.error()));
     }
 
-    if (!std::isfinite(wavelength_final_precision)) {
-      return std::unexpected(
-          "The input contained a sample with a non-finite wavelength");
-    }
-
-    Type spectral_power_final_precision = static_cast<Type>(spectral_power);
-    if (!std::isfinite(spectral_power_final_precision)) {
-      return std::unexpected(
-          "The input contained a sample with a non-finite spectral power");
-    }
-
-    auto [iter, inserted] = samples_.try_emplace(
-        wavelength_final_precision, spectral_power_final_precision);
+    auto [iter, inserted] =
+        samples_.try_emplace(sample->first, sample->second);
     if (!inserted) {
       return std::unexpected(
           "The input contained multiple samples with the same wavelength");
     }
 
+    std::apply(
+        [&](Accumulators&... accumulators) {
+          (accumulators.Accumulate(samples_, iter), ...);
+        },
+        accumulators_);
+
     return HandleSample(*iter);
   }
 };
@@ -0,0 +1,219 @@
+#include "libspd/shared_spd_library.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#include "libspd/errno_error.h"
+
+namespace libspd {
+namespace internal {
+namespace {
+
+static_assert(std::atomic_ref<uint32_t>::is_always_lock_free);
+
+constexpr std::chrono::milliseconds kPollInterval(1);
+
+std::atomic_ref<uint32_t> State(std::byte* data) {
+  return std::atomic_ref<uint32_t>(
+      reinterpret_cast<SharedSpdLibraryHeader*>(data)->state);
+}
+
+// Returns true if `name` still refers to the segment open as `fd`
+bool IsStillLinked(const std::string& name, int fd) {
+  int current = shm_open(name.c_str(), O_RDONLY, 0);
+  if (current < 0) {
+    return false;
+  }
+
+  struct stat current_stat;
+  struct stat fd_stat;
+  bool result = fstat(current, &current_stat) == 0 &&
+                fstat(fd, &fd_stat) == 0 &&
+                current_stat.st_dev == fd_stat.st_dev &&
+                current_stat.st_ino == fd_stat.st_ino;
+  close(current);
+
+  return result;
+}
+
+}  // namespace
+
+SharedMemory::SharedMemory(SharedMemory&& other)
+    : data_(other.data_), size_(other.size_) {
+  other.data_ = nullptr;
+  other.size_ = 0;
+}
+
+SharedMemory& SharedMemory::operator=(SharedMemory&& other) {
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  return *this;
+}
+
+SharedMemory::~SharedMemory() {
+  if (data_ != nullptr) {
+    munmap(const_cast<std::byte*>(data_), size_);
+  }
+}
+
+std::expected<SharedMemory, std::string> SharedMemory::Attach(
+    const std::string& name,
+    const std::function<std::expected<std::vector<std::byte>, std::string>()>&
+        build,
+    std::chrono::steady_clock::duration timeout,
+    const std::function<void()>& created) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  for (;;) {
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd >= 0) {
+      if (created) {
+        created();
+      }
+
+      // The creator holds an exclusive lock until the segment is ready so
+      // that waiters can tell when it has died. A waiter that takes the lock
+      // first considers the segment abandoned and removes it, which may have
+      // already happened by the time the lock is acquired here.
+      if (flock(fd, LOCK_EX | LOCK_NB) != 0 || !IsStillLinked(name, fd)) {
+        close(fd);
+        continue;
+      }
+
+      std::expected<std::vector<std::byte>, std::string> contents = build();
+      if (!contents || contents->size() < sizeof(SharedSpdLibraryHeader)) {
+        shm_unlink(name.c_str());
+        close(fd);
+        if (!contents) {
+          return std::unexpected(std::move(contents.error()));
+        }
+        return std::unexpected("The shared memory segment is truncated");
+      }
+
+      if (ftruncate(fd, contents->size()) != 0) {
+        auto error = ErrnoError("ftruncate");
+        shm_unlink(name.c_str());
+        close(fd);
+        return error;
+      }
+
+      void* mapping = mmap(nullptr, contents->size(), PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd, 0);
+      if (mapping == MAP_FAILED) {
+        auto error = ErrnoError("mmap");
+        shm_unlink(name.c_str());
+        close(fd);
+        return error;
+      }
+
+      std::byte* data = static_cast<std::byte*>(mapping);
+      std::memcpy(data, contents->data(), contents->size());
+      State(data).store(SharedSpdLibraryHeader::kReady,
+                        std::memory_order_release);
+      mprotect(mapping, contents->size(), PROT_READ);
+      close(fd);
+
+      return SharedMemory(data, contents->size());
+    }
+
+    if (errno != EEXIST) {
+      return ErrnoError("shm_open");
+    }
+
+    fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+      if (errno == ENOENT) {
+        // The segment was removed since the previous call; try to create it
+        continue;
+      }
+
+      return ErrnoError("shm_open");
+    }
+
+    void* mapping = MAP_FAILED;
+    size_t size = 0;
+    for (;;) {
+      // The lock is only free once the creator has either published the
+      // segment or exited, so it must be tested before the state is
+      bool creator_exited = flock(fd, LOCK_EX | LOCK_NB) == 0;
+
+      // The creator sizes the segment only once its contents are known
+      if (mapping == MAP_FAILED) {
+        struct stat fd_stat;
+        if (fstat(fd, &fd_stat) != 0) {
+          auto error = ErrnoError("fstat");
+          close(fd);
+          return error;
+        }
+
+        size = static_cast<size_t>(fd_stat.st_size);
+        if (size >= sizeof(SharedSpdLibraryHeader)) {
+          mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+          if (mapping == MAP_FAILED) {
+            auto error = ErrnoError("mmap");
+            close(fd);
+            return error;
+          }
+        }
+      }
+
+      if (mapping != MAP_FAILED &&
+          State(static_cast<std::byte*>(mapping))
+                  .load(std::memory_order_acquire) ==
+              SharedSpdLibraryHeader::kReady) {
+        close(fd);
+        return SharedMemory(static_cast<std::byte*>(mapping), size);
+      }
+
+      if (creator_exited || !IsStillLinked(name, fd)) {
+        // The creator failed or died before publishing the segment. If the
+        // name still refers to it, remove it so that it can be rebuilt.
+        if (creator_exited && IsStillLinked(name, fd)) {
+          shm_unlink(name.c_str());
+        }
+
+        break;
+      }
+
+      if (std::chrono::steady_clock::now() > deadline) {
+        if (mapping != MAP_FAILED) {
+          munmap(mapping, size);
+        }
+        close(fd);
+        return std::unexpected(
+            "Timed out waiting for the shared memory segment to be "
+            "initialized");
+      }
+
+      std::this_thread::sleep_for(kPollInterval);
+    }
+
+    if (mapping != MAP_FAILED) {
+      munmap(mapping, size);
+    }
+    close(fd);
+  }
+}
+
+}  // namespace internal
+
+std::expected<void, std::string> RemoveSharedSpdLibrary(
+    const std::string& name) {
+  if (shm_unlink(name.c_str()) != 0) {
+    return internal::ErrnoError("shm_unlink");
+  }
+
+  return std::expected<void, std::string>();
+}
+
+}  // namespace libspd
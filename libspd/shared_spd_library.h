@@ -0,0 +1,331 @@
+#ifndef _LIBSPD_SHARED_SPD_LIBRARY_
+#define _LIBSPD_SHARED_SPD_LIBRARY_
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <functional>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libspd {
+namespace internal {
+
+// The header at the start of every shared memory segment. The remainder of
+// the segment is laid out as follows, with every offset relative to the start
+// of the segment so that the segment may be mapped at any address.
+//
+//   SharedSpdLibraryEntry entries[num_spectra];  // Sorted by name
+//   char names[];
+//   Type values[];  // Wavelengths followed by spectral powers for each entry
+struct SharedSpdLibraryHeader {
+  static constexpr uint64_t kMagic = 0x44505342494C0001;  // "\1LIBSPD"
+  static constexpr uint32_t kFormatVersion = 1;
+
+  enum State : uint32_t {
+    kInitializing = 0,
+    kReady = 1,
+  };
+
+  uint64_t magic;
+  uint32_t state;  // Only accessed atomically
+  uint32_t format_version;
+  uint64_t version;
+  uint64_t value_size;
+  uint64_t num_spectra;
+};
+
+struct SharedSpdLibraryEntry {
+  uint64_t name_offset;
+  uint64_t name_size;
+  uint64_t values_offset;
+  uint64_t num_samples;
+};
+
+// A read-only mapping of a POSIX shared memory segment
+class SharedMemory {
+ public:
+  SharedMemory() = default;
+  SharedMemory(SharedMemory&& other);
+  SharedMemory& operator=(SharedMemory&& other);
+  ~SharedMemory();
+
+  // Maps the segment called `name`. If the segment does not yet exist, it is
+  // created and filled with the bytes returned by `build`. Processes that
+  // find the segment already exists wait up to `timeout` for its header to
+  // reach the ready state before returning. If the process creating the
+  // segment exits before it is ready, the segment is removed and rebuilt.
+  //
+  // If set, `created` is called after this process creates the segment but
+  // before it locks it so that tests can stall a creator at that point.
+  static std::expected<SharedMemory, std::string> Attach(
+      const std::string& name,
+      const std::function<std::expected<std::vector<std::byte>, std::string>()>&
+          build,
+      std::chrono::steady_clock::duration timeout,
+      const std::function<void()>& created = nullptr);
+
+  std::span<const std::byte> data() const {
+    return std::span<const std::byte>(data_, size_);
+  }
+
+ private:
+  SharedMemory(const std::byte* data, size_t size) : data_(data), size_(size) {}
+
+  const std::byte* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace internal
+
+// A read-only library of named spectra shared between every process on a
+// machine through a named POSIX shared memory segment. The first process to
+// attach parses the spectra and publishes them into the segment in a flat,
+// pointer-free layout; every other process maps the segment read-only without
+// parsing anything or keeping a private copy of the samples.
+//
+// `version` identifies the contents of the library (for instance, a hash of
+// the set of files it was loaded from) and attaching to a segment created with
+// a different version or floating point type returns an error. Callers that
+// wish to replace a segment should call `RemoveSharedSpdLibrary` and then
+// attach again.
+template <std::floating_point Type>
+class SharedSpdLibrary {
+ public:
+  using Spectra = std::map<std::string, std::map<Type, Type>, std::less<>>;
+
+  // `timeout` bounds how long to wait for another process that is still
+  // loading the library. If that process exits before it finishes, the
+  // library is loaded again by one of the processes waiting for it.
+  //
+  // NOTE: `name` must follow the rules for `shm_open` names (for example,
+  // "/my_library")
+  static std::expected<SharedSpdLibrary, std::string> Attach(
+      const std::string& name, uint64_t version,
+      const std::function<std::expected<Spectra, std::string>()>& load,
+      std::chrono::steady_clock::duration timeout = std::chrono::seconds(60)) {
+    std::expected<internal::SharedMemory, std::string> memory =
+        internal::SharedMemory::Attach(
+            name,
+            [&]() -> std::expected<std::vector<std::byte>, std::string> {
+              std::expected<Spectra, std::string> spectra = load();
+              if (!spectra) {
+                return std::unexpected(std::move(spectra.error()));
+              }
+
+              return Serialize(*spectra, version);
+            },
+            timeout);
+    if (!memory) {
+      return std::unexpected(std::move(memory.error()));
+    }
+
+    std::span<const std::byte> data = memory->data();
+    if (data.size() < sizeof(internal::SharedSpdLibraryHeader)) {
+      return std::unexpected("The shared memory segment is truncated");
+    }
+
+    const auto* header =
+        reinterpret_cast<const internal::SharedSpdLibraryHeader*>(data.data());
+    if (header->magic != internal::SharedSpdLibraryHeader::kMagic ||
+        header->format_version !=
+            internal::SharedSpdLibraryHeader::kFormatVersion ||
+        header->value_size != sizeof(Type)) {
+      return std::unexpected(
+          "The shared memory segment has an incompatible format");
+    }
+
+    if (header->version != version) {
+      return std::unexpected(
+          "The shared memory segment has a different version");
+    }
+
+    if ((data.size() - sizeof(internal::SharedSpdLibraryHeader)) /
+            sizeof(internal::SharedSpdLibraryEntry) <
+        header->num_spectra) {
+      return std::unexpected("The shared memory segment is truncated");
+    }
+
+    if (std::expected<void, std::string> result =
+            Validate(data, header->num_spectra);
+        !result) {
+      return std::unexpected(std::move(result.error()));
+    }
+
+    return SharedSpdLibrary(std::move(*memory), header->num_spectra);
+  }
+
+  size_t size() const { return num_spectra_; }
+
+  // NOTE: Behavior is undefined if index >= size() for the functions below
+  std::string_view name(size_t index) const {
+    const internal::SharedSpdLibraryEntry& entry = entries()[index];
+    return std::string_view(
+        reinterpret_cast<const char*>(memory_.data().data()) +
+            entry.name_offset,
+        entry.name_size);
+  }
+
+  std::span<const Type> wavelengths(size_t index) const {
+    const internal::SharedSpdLibraryEntry& entry = entries()[index];
+    return std::span<const Type>(values(entry.values_offset),
+                                 entry.num_samples);
+  }
+
+  std::span<const Type> spectral_powers(size_t index) const {
+    const internal::SharedSpdLibraryEntry& entry = entries()[index];
+    return std::span<const Type>(
+        values(entry.values_offset) + entry.num_samples, entry.num_samples);
+  }
+
+  std::optional<size_t> Find(std::string_view name) const {
+    size_t low = 0;
+    size_t high = num_spectra_;
+    while (low < high) {
+      size_t mid = low + (high - low) / 2;
+      if (this->name(mid) < name) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    if (low == num_spectra_ || this->name(low) != name) {
+      return std::nullopt;
+    }
+
+    return low;
+  }
+
+ private:
+  SharedSpdLibrary(internal::SharedMemory memory, size_t num_spectra)
+      : memory_(std::move(memory)), num_spectra_(num_spectra) {}
+
+  // Checks that every entry lies within the segment and that the entries are
+  // sorted so that a corrupt segment cannot cause out of bounds reads
+  static std::expected<void, std::string> Validate(
+      std::span<const std::byte> data, uint64_t num_spectra) {
+    const auto* entries =
+        reinterpret_cast<const internal::SharedSpdLibraryEntry*>(
+            data.data() + sizeof(internal::SharedSpdLibraryHeader));
+
+    std::string_view previous_name;
+    for (uint64_t i = 0; i < num_spectra; i++) {
+      const internal::SharedSpdLibraryEntry& entry = entries[i];
+      if (entry.name_offset > data.size() ||
+          entry.name_size > data.size() - entry.name_offset ||
+          entry.values_offset > data.size() ||
+          entry.num_samples >
+              (data.size() - entry.values_offset) / (2 * sizeof(Type))) {
+        return std::unexpected(
+            "The shared memory segment contains an entry that is out of "
+            "bounds");
+      }
+
+      if (entry.values_offset % alignof(Type) != 0) {
+        return std::unexpected(
+            "The shared memory segment contains an entry that is misaligned");
+      }
+
+      std::string_view name(
+          reinterpret_cast<const char*>(data.data()) + entry.name_offset,
+          entry.name_size);
+      if (i != 0 && name <= previous_name) {
+        return std::unexpected(
+            "The shared memory segment contains entries that are not sorted "
+            "by name");
+      }
+
+      previous_name = name;
+    }
+
+    return std::expected<void, std::string>();
+  }
+
+  static size_t Align(size_t offset) {
+    return (offset + alignof(Type) - 1) / alignof(Type) * alignof(Type);
+  }
+
+  static std::vector<std::byte> Serialize(const Spectra& spectra,
+                                          uint64_t version) {
+    size_t names_offset =
+        sizeof(internal::SharedSpdLibraryHeader) +
+        spectra.size() * sizeof(internal::SharedSpdLibraryEntry);
+
+    size_t values_offset = names_offset;
+    for (const auto& [name, samples] : spectra) {
+      values_offset += name.size();
+    }
+    values_offset = Align(values_offset);
+
+    size_t total_size = values_offset;
+    for (const auto& [name, samples] : spectra) {
+      total_size += 2 * samples.size() * sizeof(Type);
+    }
+
+    std::vector<std::byte> result(total_size);
+
+    internal::SharedSpdLibraryHeader header;
+    header.magic = internal::SharedSpdLibraryHeader::kMagic;
+    header.state = internal::SharedSpdLibraryHeader::kInitializing;
+    header.format_version = internal::SharedSpdLibraryHeader::kFormatVersion;
+    header.version = version;
+    header.value_size = sizeof(Type);
+    header.num_spectra = spectra.size();
+    std::memcpy(result.data(), &header, sizeof(header));
+
+    size_t entry_offset = sizeof(internal::SharedSpdLibraryHeader);
+    for (const auto& [name, samples] : spectra) {
+      internal::SharedSpdLibraryEntry entry;
+      entry.name_offset = names_offset;
+      entry.name_size = name.size();
+      entry.values_offset = values_offset;
+      entry.num_samples = samples.size();
+      std::memcpy(result.data() + entry_offset, &entry, sizeof(entry));
+      entry_offset += sizeof(entry);
+
+      std::memcpy(result.data() + names_offset, name.data(), name.size());
+      names_offset += name.size();
+
+      Type* wavelengths =
+          reinterpret_cast<Type*>(result.data() + values_offset);
+      Type* spectral_powers = wavelengths + samples.size();
+      for (const auto& [wavelength, spectral_power] : samples) {
+        *wavelengths++ = wavelength;
+        *spectral_powers++ = spectral_power;
+      }
+      values_offset += 2 * samples.size() * sizeof(Type);
+    }
+
+    return result;
+  }
+
+  const internal::SharedSpdLibraryEntry* entries() const {
+    return reinterpret_cast<const internal::SharedSpdLibraryEntry*>(
+        memory_.data().data() + sizeof(internal::SharedSpdLibraryHeader));
+  }
+
+  const Type* values(uint64_t offset) const {
+    return reinterpret_cast<const Type*>(memory_.data().data() + offset);
+  }
+
+  internal::SharedMemory memory_;
+  size_t num_spectra_;
+};
+
+// Removes the shared memory segment called `name`. Processes that are already
+// attached to it keep their mapping.
+std::expected<void, std::string> RemoveSharedSpdLibrary(
+    const std::string& name);
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_SHARED_SPD_LIBRARY_
@@ -0,0 +1,393 @@
+#include "libspd/shared_spd_library.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+
+std::string SegmentName(const std::string& test_name) {
+  return "/libspd_test_" + test_name + "_" + std::to_string(getpid());
+}
+
+SharedSpdLibrary<float>::Spectra MakeSpectra() {
+  SharedSpdLibrary<float>::Spectra spectra;
+  spectra["b"] = {{1.0f, 2.0f}, {3.0f, 4.0f}};
+  spectra["a"] = {{5.0f, 6.0f}};
+  spectra["c"] = {};
+  return spectra;
+}
+
+class SharedSpdLibraryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    name_ = SegmentName(
+        ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    RemoveSharedSpdLibrary(name_);
+  }
+
+  void TearDown() override { RemoveSharedSpdLibrary(name_); }
+
+  // Publishes the segment for `MakeSpectra` as `name_` after first passing
+  // its entries to `modify`
+  void PublishModified(
+      const std::function<void(internal::SharedSpdLibraryEntry* entries)>&
+          modify) {
+    std::string valid_name = name_ + "_valid";
+    ASSERT_TRUE(SharedSpdLibrary<float>::Attach(
+        valid_name, 1,
+        []() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+          return MakeSpectra();
+        }));
+
+    auto valid = internal::SharedMemory::Attach(
+        valid_name,
+        []() -> std::expected<std::vector<std::byte>, std::string> {
+          return std::unexpected("unreachable");
+        },
+        std::chrono::seconds(60));
+    RemoveSharedSpdLibrary(valid_name);
+    ASSERT_TRUE(valid);
+
+    std::vector<std::byte> contents(valid->data().begin(),
+                                    valid->data().end());
+    modify(reinterpret_cast<internal::SharedSpdLibraryEntry*>(
+        contents.data() + sizeof(internal::SharedSpdLibraryHeader)));
+
+    ASSERT_TRUE(internal::SharedMemory::Attach(
+        name_,
+        [&]() -> std::expected<std::vector<std::byte>, std::string> {
+          return contents;
+        },
+        std::chrono::seconds(60)));
+  }
+
+  std::expected<SharedSpdLibrary<float>, std::string> Attach() {
+    return SharedSpdLibrary<float>::Attach(
+        name_, 1,
+        []() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+          return MakeSpectra();
+        });
+  }
+
+  std::string name_;
+};
+
+TEST_F(SharedSpdLibraryTest, CreatesAndReads) {
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(library);
+  ASSERT_EQ(3u, library->size());
+
+  EXPECT_EQ("a", library->name(0));
+  EXPECT_THAT(library->wavelengths(0), ElementsAre(5.0f));
+  EXPECT_THAT(library->spectral_powers(0), ElementsAre(6.0f));
+
+  EXPECT_EQ("b", library->name(1));
+  EXPECT_THAT(library->wavelengths(1), ElementsAre(1.0f, 3.0f));
+  EXPECT_THAT(library->spectral_powers(1), ElementsAre(2.0f, 4.0f));
+
+  EXPECT_EQ("c", library->name(2));
+  EXPECT_TRUE(library->wavelengths(2).empty());
+  EXPECT_TRUE(library->spectral_powers(2).empty());
+}
+
+TEST_F(SharedSpdLibraryTest, Find) {
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(library);
+  EXPECT_EQ(0u, library->Find("a"));
+  EXPECT_EQ(1u, library->Find("b"));
+  EXPECT_EQ(2u, library->Find("c"));
+  EXPECT_FALSE(library->Find(""));
+  EXPECT_FALSE(library->Find("ab"));
+  EXPECT_FALSE(library->Find("d"));
+}
+
+TEST_F(SharedSpdLibraryTest, SecondAttachDoesNotLoad) {
+  auto first = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(first);
+
+  bool loaded = false;
+  auto second = SharedSpdLibrary<float>::Attach(
+      name_, 1,
+      [&]() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+        loaded = true;
+        return MakeSpectra();
+      });
+  ASSERT_TRUE(second);
+  EXPECT_FALSE(loaded);
+  EXPECT_THAT(second->wavelengths(1), ElementsAre(1.0f, 3.0f));
+}
+
+TEST_F(SharedSpdLibraryTest, DifferentVersion) {
+  auto first = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(first);
+
+  auto second = SharedSpdLibrary<float>::Attach(
+      name_, 2, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_FALSE(second);
+  EXPECT_EQ("The shared memory segment has a different version",
+            second.error());
+}
+
+TEST_F(SharedSpdLibraryTest, DifferentType) {
+  auto first = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(first);
+
+  auto second = SharedSpdLibrary<double>::Attach(
+      name_, 1,
+      []() -> std::expected<SharedSpdLibrary<double>::Spectra, std::string> {
+        return SharedSpdLibrary<double>::Spectra();
+      });
+  ASSERT_FALSE(second);
+  EXPECT_EQ("The shared memory segment has an incompatible format",
+            second.error());
+}
+
+TEST_F(SharedSpdLibraryTest, LoadFails) {
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1,
+      []() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+        return std::unexpected("failed");
+      });
+  ASSERT_FALSE(library);
+  EXPECT_EQ("failed", library.error());
+
+  // The failed segment is removed so that the next attach loads again
+  library = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(library);
+  EXPECT_EQ(3u, library->size());
+}
+
+TEST_F(SharedSpdLibraryTest, Remove) {
+  EXPECT_FALSE(RemoveSharedSpdLibrary(name_));
+
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1, []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                      std::string> { return MakeSpectra(); });
+  ASSERT_TRUE(library);
+  EXPECT_TRUE(RemoveSharedSpdLibrary(name_));
+
+  // Existing mappings remain valid after removal
+  EXPECT_THAT(library->wavelengths(1), ElementsAre(1.0f, 3.0f));
+}
+
+TEST_F(SharedSpdLibraryTest, NameOutOfBounds) {
+  PublishModified([](internal::SharedSpdLibraryEntry* entries) {
+    entries[2].name_size = UINT64_MAX;
+  });
+  EXPECT_EQ(
+      "The shared memory segment contains an entry that is out of bounds",
+      Attach().error());
+}
+
+TEST_F(SharedSpdLibraryTest, ValuesOutOfBounds) {
+  PublishModified([](internal::SharedSpdLibraryEntry* entries) {
+    entries[1].num_samples = 1000;
+  });
+  EXPECT_EQ(
+      "The shared memory segment contains an entry that is out of bounds",
+      Attach().error());
+}
+
+TEST_F(SharedSpdLibraryTest, ValuesMisaligned) {
+  PublishModified([](internal::SharedSpdLibraryEntry* entries) {
+    entries[0].values_offset += 1;
+  });
+  EXPECT_EQ("The shared memory segment contains an entry that is misaligned",
+            Attach().error());
+}
+
+TEST_F(SharedSpdLibraryTest, NamesNotSorted) {
+  PublishModified([](internal::SharedSpdLibraryEntry* entries) {
+    std::swap(entries[0].name_offset, entries[1].name_offset);
+  });
+  EXPECT_EQ(
+      "The shared memory segment contains entries that are not sorted by "
+      "name",
+      Attach().error());
+}
+
+// Forks a child process that starts creating the segment `name` and then
+// blocks forever. Returns once the child has started loading.
+pid_t ForkStalledCreator(const std::string& name) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    return -1;
+  }
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    SharedSpdLibrary<float>::Attach(
+        name, 1,
+        [&]() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+          char signal = 0;
+          if (write(fds[1], &signal, 1) != 1) {
+            _exit(1);
+          }
+
+          for (;;) {
+            pause();
+          }
+        });
+    _exit(1);
+  }
+
+  close(fds[1]);
+  char signal;
+  if (pid < 0 || read(fds[0], &signal, 1) != 1) {
+    pid = -1;
+  }
+  close(fds[0]);
+
+  return pid;
+}
+
+TEST_F(SharedSpdLibraryTest, CreatorStillLoading) {
+  pid_t creator = ForkStalledCreator(name_);
+  ASSERT_NE(-1, creator);
+
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1,
+      []() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+        return MakeSpectra();
+      },
+      std::chrono::milliseconds(50));
+  ASSERT_FALSE(library);
+  EXPECT_EQ(
+      "Timed out waiting for the shared memory segment to be initialized",
+      library.error());
+
+  kill(creator, SIGKILL);
+  waitpid(creator, nullptr, 0);
+}
+
+TEST_F(SharedSpdLibraryTest, CreatorDies) {
+  pid_t creator = ForkStalledCreator(name_);
+  ASSERT_NE(-1, creator);
+  kill(creator, SIGKILL);
+  waitpid(creator, nullptr, 0);
+
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1,
+      []() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+        return MakeSpectra();
+      },
+      std::chrono::seconds(10));
+  ASSERT_TRUE(library);
+  EXPECT_EQ(3u, library->size());
+}
+
+TEST_F(SharedSpdLibraryTest, CreatorDiesWhileWaiting) {
+  pid_t creator = ForkStalledCreator(name_);
+  ASSERT_NE(-1, creator);
+
+  std::thread killer([creator]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    kill(creator, SIGKILL);
+    waitpid(creator, nullptr, 0);
+  });
+
+  auto library = SharedSpdLibrary<float>::Attach(
+      name_, 1,
+      []() -> std::expected<SharedSpdLibrary<float>::Spectra, std::string> {
+        return MakeSpectra();
+      },
+      std::chrono::seconds(10));
+  killer.join();
+
+  ASSERT_TRUE(library);
+  EXPECT_EQ(3u, library->size());
+}
+
+TEST_F(SharedSpdLibraryTest, CreatorStalledBeforeLocking) {
+  int num_builds = 0;
+  auto build = [&]() -> std::expected<std::vector<std::byte>, std::string> {
+    num_builds += 1;
+    return std::vector<std::byte>(sizeof(internal::SharedSpdLibraryHeader),
+                                  std::byte(num_builds));
+  };
+
+  // The first creator is stalled after creating the segment but before
+  // locking it, during which time a waiter finds the segment unlocked,
+  // removes it as abandoned, and publishes its own
+  std::expected<internal::SharedMemory, std::string> waiter;
+  bool stalled = false;
+  auto creator = internal::SharedMemory::Attach(
+      name_, build, std::chrono::seconds(10), [&]() {
+        if (!stalled) {
+          stalled = true;
+          waiter = internal::SharedMemory::Attach(name_, build,
+                                                  std::chrono::seconds(10));
+        }
+      });
+
+  ASSERT_TRUE(stalled);
+  ASSERT_TRUE(waiter);
+  ASSERT_TRUE(creator);
+  EXPECT_EQ(1, num_builds);
+  EXPECT_EQ(std::byte(1), waiter->data()[0]);
+  EXPECT_EQ(std::byte(1), creator->data()[0]);
+}
+
+TEST_F(SharedSpdLibraryTest, ConcurrentAttach) {
+  constexpr int kNumProcesses = 8;
+
+  std::vector<pid_t> children;
+  for (int i = 0; i < kNumProcesses; i++) {
+    pid_t pid = fork();
+    ASSERT_NE(-1, pid);
+    if (pid == 0) {
+      auto library = SharedSpdLibrary<float>::Attach(
+          name_, 1,
+          []() -> std::expected<SharedSpdLibrary<float>::Spectra,
+                                std::string> {
+            usleep(10000);
+            return MakeSpectra();
+          });
+      bool valid = library && library->size() == 3 &&
+                   library->Find("b") == 1u &&
+                   library->spectral_powers(1).size() == 2 &&
+                   library->spectral_powers(1)[1] == 4.0f;
+      _exit(valid ? 0 : 1);
+    }
+    children.push_back(pid);
+  }
+
+  for (pid_t child : children) {
+    int status;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+  }
+}
+
+}  // namespace
+}  // namespace libspd
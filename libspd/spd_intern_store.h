@@ -0,0 +1,206 @@
+#ifndef _LIBSPD_SPD_INTERN_STORE_
+#define _LIBSPD_SPD_INTERN_STORE_
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace libspd {
+namespace internal {
+
+constexpr uint64_t MixHash(uint64_t value) {
+  value ^= value >> 30;
+  value *= 0xBF58476D1CE4E5B9;
+  value ^= value >> 27;
+  value *= 0x94D049BB133111EB;
+  value ^= value >> 31;
+  return value;
+}
+
+// Hashes the value of a number rather than its representation so that types
+// with padding bits (such as `long double`) hash consistently and so that zero
+// and negative zero, which compare equal, hash equally
+template <std::floating_point Type>
+uint64_t HashValue(Type value) {
+  if (!(std::abs(value) <= std::numeric_limits<Type>::max())) {
+    return MixHash(value < static_cast<Type>(0.0) ? 1 : 2);
+  }
+
+  int exponent = 0;
+  Type significand = std::frexp(value, &exponent);
+
+  bool negative = significand < static_cast<Type>(0.0);
+  if (negative) {
+    significand = -significand;
+  }
+
+  uint64_t significand_bits = static_cast<uint64_t>(
+      std::ldexp(significand, std::numeric_limits<Type>::digits));
+  uint64_t exponent_bits =
+      (static_cast<uint64_t>(static_cast<uint32_t>(exponent)) << 1) |
+      static_cast<uint64_t>(negative);
+
+  return MixHash(significand_bits ^ MixHash(exponent_bits));
+}
+
+template <std::floating_point Type>
+uint64_t HashSample(Type wavelength, Type spectral_power) {
+  return MixHash(HashValue(wavelength) ^
+                 (HashValue(spectral_power) * 0x9E3779B97F4A7C15));
+}
+
+// Sample hashes are combined by addition so that the result does not depend
+// on the order in which the samples were added
+constexpr uint64_t FinishSpdHash(uint64_t sum_of_sample_hashes,
+                                 size_t num_samples) {
+  return MixHash(sum_of_sample_hashes + static_cast<uint64_t>(num_samples));
+}
+
+}  // namespace internal
+
+template <std::floating_point Type>
+uint64_t HashSpd(const std::map<Type, Type>& samples) {
+  uint64_t sum = 0;
+  for (const auto& [wavelength, spectral_power] : samples) {
+    sum += internal::HashSample(wavelength, spectral_power);
+  }
+
+  return internal::FinishSpdHash(sum, samples.size());
+}
+
+// Computes `HashSpd` of the samples of an SPD file while it is parsed. This
+// follows the interface expected of the accumulators passed to
+// `ValidatingSpdReader` (see `libspd/readers/validating_spd_reader.h`).
+template <std::floating_point Type>
+class SpdHashAccumulator {
+ public:
+  void Accumulate(const std::map<Type, Type>& samples,
+                  typename std::map<Type, Type>::const_iterator sample) {
+    sum_ += internal::HashSample(sample->first, sample->second);
+    num_samples_ += 1;
+  }
+
+  uint64_t hash() const {
+    return internal::FinishSpdHash(sum_, num_samples_);
+  }
+
+ private:
+  uint64_t sum_ = 0;
+  size_t num_samples_ = 0;
+};
+
+struct SpdInternStoreStatistics {
+  // The number of calls to `Intern`
+  size_t lookups = 0;
+
+  // The number of calls to `Intern` that returned an existing spectrum
+  size_t hits = 0;
+
+  // The total number of samples in the spectra passed to `Intern` that were
+  // discarded in favor of an existing copy
+  size_t samples_saved = 0;
+
+  // The number of distinct spectra currently held by the store
+  size_t unique_spectra = 0;
+
+  double hit_rate() const {
+    return lookups == 0 ? 0.0
+                        : static_cast<double>(hits) /
+                              static_cast<double>(lookups);
+  }
+};
+
+// Deduplicates identical spectra so that each one is stored only once. Every
+// spectrum passed to `Intern` that has the same samples as one already in the
+// store is discarded and a handle to the existing copy is returned instead,
+// which means that two handles returned by the same store hold equal samples
+// exactly when they point to the same object.
+//
+// The store only holds weak references, so a spectrum is freed once the last
+// handle to it is destroyed. It is safe to call any method from multiple
+// threads concurrently.
+template <std::floating_point Type>
+class SpdInternStore {
+ public:
+  using Handle = std::shared_ptr<const std::map<Type, Type>>;
+
+  Handle Intern(std::map<Type, Type> samples) {
+    uint64_t hash = HashSpd(samples);
+    return Intern(std::move(samples), hash);
+  }
+
+  // Interns `samples` using a hash which was already computed while they were
+  // parsed, for instance by a `SpdHashAccumulator`.
+  //
+  // NOTE: Behavior is undefined if hash is not equal to HashSpd(samples)
+  Handle Intern(std::map<Type, Type> samples, uint64_t hash) {
+    std::lock_guard lock(mutex_);
+
+    statistics_.lookups += 1;
+
+    auto [begin, end] = spectra_.equal_range(hash);
+    for (auto iter = begin; iter != end;) {
+      Handle existing = iter->second.lock();
+      if (!existing) {
+        iter = spectra_.erase(iter);
+        continue;
+      }
+
+      if (*existing == samples) {
+        statistics_.hits += 1;
+        statistics_.samples_saved += samples.size();
+        return existing;
+      }
+
+      ++iter;
+    }
+
+    // Periodically drop the entries of spectra that have been freed so that
+    // the store does not grow without bound
+    if (spectra_.size() >= prune_threshold_) {
+      std::erase_if(spectra_,
+                    [](const auto& entry) { return entry.second.expired(); });
+      prune_threshold_ = std::max(kMinPruneThreshold, 2 * spectra_.size());
+    }
+
+    Handle result =
+        std::make_shared<const std::map<Type, Type>>(std::move(samples));
+    spectra_.emplace(hash, result);
+
+    return result;
+  }
+
+  SpdInternStoreStatistics GetStatistics() const {
+    std::lock_guard lock(mutex_);
+
+    SpdInternStoreStatistics result = statistics_;
+    for (const auto& [hash, spectrum] : spectra_) {
+      if (!spectrum.expired()) {
+        result.unique_spectra += 1;
+      }
+    }
+
+    return result;
+  }
+
+ private:
+  static constexpr size_t kMinPruneThreshold = 64;
+
+  mutable std::mutex mutex_;
+  std::unordered_multimap<uint64_t, std::weak_ptr<const std::map<Type, Type>>>
+      spectra_;
+  size_t prune_threshold_ = kMinPruneThreshold;
+  SpdInternStoreStatistics statistics_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_SPD_INTERN_STORE_
@@ -0,0 +1,169 @@
+#include "libspd/spd_intern_store.h"
+
+#include <thread>
+#include <vector>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/readers/validating_spd_reader.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+class HashingSpdReader final
+    : public ValidatingSpdReader<float, SpdHashAccumulator<float>> {
+ protected:
+  std::expected<void, std::string> HandleComment(
+      std::string_view comment) override {
+    return std::expected<void, std::string>();
+  }
+
+  std::expected<void, std::string> HandleSample(
+      std::pair<const float, float>& sample) override {
+    return std::expected<void, std::string>();
+  }
+};
+
+TEST(HashSpd, IgnoresSignOfZero) {
+  std::map<float, float> positive = {{1.0f, 0.0f}};
+  std::map<float, float> negative = {{1.0f, -0.0f}};
+  EXPECT_EQ(HashSpd(positive), HashSpd(negative));
+}
+
+TEST(HashSpd, DependsOnSamples) {
+  std::map<double, double> first = {{1.0, 2.0}, {3.0, 4.0}};
+  std::map<double, double> second = {{1.0, 4.0}, {3.0, 2.0}};
+  std::map<double, double> third = {{1.0, 2.0}};
+  EXPECT_NE(HashSpd(first), HashSpd(second));
+  EXPECT_NE(HashSpd(first), HashSpd(third));
+}
+
+TEST(HashSpd, LongDouble) {
+  std::map<long double, long double> first = {{1.0L, 2.0L}};
+  std::map<long double, long double> second = {{1.0L, 2.0L}};
+  std::map<long double, long double> third = {{1.0L, 2.0L + 1e-15L}};
+  EXPECT_EQ(HashSpd(first), HashSpd(second));
+  EXPECT_NE(HashSpd(first), HashSpd(third));
+}
+
+TEST(SpdHashAccumulator, MatchesHashSpd) {
+  HashingSpdReader reader;
+  ASSERT_TRUE(reader.ReadFrom(std::string_view("5.0 6.0\n1.0 2.0\n3.0 4.0")));
+
+  uint64_t hash = std::get<0>(reader.GetAccumulators()).hash();
+  EXPECT_EQ(HashSpd(reader.Reset()), hash);
+}
+
+TEST(SpdHashAccumulator, IgnoresOrder) {
+  HashingSpdReader reader;
+
+  ASSERT_TRUE(reader.ReadFrom(std::string_view("1.0 2.0\n3.0 4.0")));
+  uint64_t first = std::get<0>(reader.GetAccumulators()).hash();
+  reader.Reset();
+
+  ASSERT_TRUE(reader.ReadFrom(std::string_view("3.0 4.0\n1.0 2.0")));
+  uint64_t second = std::get<0>(reader.GetAccumulators()).hash();
+
+  EXPECT_EQ(first, second);
+}
+
+TEST(SpdInternStore, DeduplicatesEqualSpectra) {
+  SpdInternStore<float> store;
+
+  auto first = store.Intern({{1.0f, 2.0f}, {3.0f, 4.0f}});
+  auto second = store.Intern({{1.0f, 2.0f}, {3.0f, 4.0f}});
+  auto third = store.Intern({{1.0f, 2.0f}});
+
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, third);
+  EXPECT_THAT(*first, ElementsAre(Pair(1.0f, 2.0f), Pair(3.0f, 4.0f)));
+  EXPECT_THAT(*third, ElementsAre(Pair(1.0f, 2.0f)));
+
+  SpdInternStoreStatistics statistics = store.GetStatistics();
+  EXPECT_EQ(3u, statistics.lookups);
+  EXPECT_EQ(1u, statistics.hits);
+  EXPECT_EQ(2u, statistics.samples_saved);
+  EXPECT_EQ(2u, statistics.unique_spectra);
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, statistics.hit_rate());
+}
+
+TEST(SpdInternStore, Empty) {
+  SpdInternStore<float> store;
+  EXPECT_EQ(store.Intern({}), store.Intern({}));
+  EXPECT_EQ(0.0, SpdInternStore<float>().GetStatistics().hit_rate());
+}
+
+TEST(SpdInternStore, InternWithHashFromReader) {
+  SpdInternStore<float> store;
+  HashingSpdReader reader;
+
+  ASSERT_TRUE(reader.ReadFrom(std::string_view("3.0 4.0\n1.0 2.0")));
+  uint64_t hash = std::get<0>(reader.GetAccumulators()).hash();
+  auto first = store.Intern(reader.Reset(), hash);
+
+  auto second = store.Intern({{1.0f, 2.0f}, {3.0f, 4.0f}});
+  EXPECT_EQ(first, second);
+}
+
+TEST(SpdInternStore, ReleasesUnusedSpectra) {
+  SpdInternStore<float> store;
+
+  std::weak_ptr<const std::map<float, float>> weak =
+      store.Intern({{1.0f, 2.0f}});
+  EXPECT_TRUE(weak.expired());
+  EXPECT_EQ(0u, store.GetStatistics().unique_spectra);
+
+  auto handle = store.Intern({{1.0f, 2.0f}});
+  EXPECT_THAT(*handle, ElementsAre(Pair(1.0f, 2.0f)));
+  EXPECT_EQ(1u, store.GetStatistics().unique_spectra);
+  EXPECT_EQ(0u, store.GetStatistics().hits);
+}
+
+TEST(SpdInternStore, PrunesReleasedSpectra) {
+  SpdInternStore<float> store;
+  for (int i = 1; i <= 1000; i++) {
+    store.Intern({{static_cast<float>(i), 1.0f}});
+  }
+
+  auto handle = store.Intern({{1.0f, 1.0f}});
+  EXPECT_EQ(1u, store.GetStatistics().unique_spectra);
+  EXPECT_EQ(0u, store.GetStatistics().hits);
+}
+
+TEST(SpdInternStore, Concurrent) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNumSpectra = 100;
+
+  SpdInternStore<float> store;
+  std::vector<std::vector<SpdInternStore<float>::Handle>> handles(kNumThreads);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back([&, i] {
+      for (int j = 1; j <= kNumSpectra; j++) {
+        handles[i].push_back(store.Intern({{static_cast<float>(j), 1.0f}}));
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 1; i < kNumThreads; i++) {
+    EXPECT_EQ(handles[0], handles[i]);
+  }
+
+  SpdInternStoreStatistics statistics = store.GetStatistics();
+  EXPECT_EQ(static_cast<size_t>(kNumThreads * kNumSpectra),
+            statistics.lookups);
+  EXPECT_EQ(static_cast<size_t>((kNumThreads - 1) * kNumSpectra),
+            statistics.hits);
+  EXPECT_EQ(static_cast<size_t>(kNumSpectra), statistics.unique_spectra);
+}
+
+}  // namespace
+}  // namespace libspd
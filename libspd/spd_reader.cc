@@ -1,6 +1,5 @@
 #include "libspd/spd_reader.h"
 
-#include <charconv>
 #include <optional>
 
 namespace libspd {
@@ -58,38 +57,6 @@ std::expected<void, std::string> ReadNextLine(std::istream& input,
   return std::expected<void, std::string>();
 }
 
-std::optional<std::string_view> ReadNextToken(std::string_view& text) {
-  while (!text.empty()) {
-    if (std::isgraph(text.front())) {
-      break;
-    }
-
-    text.remove_prefix(1);
-  }
-
-  if (text.empty()) {
-    return std::nullopt;
-  }
-
-  if (text.front() == '#') {
-    std::string_view result;
-    std::swap(result, text);
-    return result;
-  }
-
-  size_t token_length;
-  for (token_length = 1; token_length < text.size(); token_length++) {
-    if (!std::isgraph(text[token_length]) || text[token_length] == '#') {
-      break;
-    }
-  }
-
-  std::string_view result = text.substr(0, token_length);
-  text.remove_prefix(token_length);
-
-  return result;
-}
-
 }  // namespace
 
 std::expected<void, std::string> SpdReader::ReadFrom(std::istream& input) {
@@ -99,54 +66,21 @@ std::expected<void, std::string> SpdReader::ReadFrom(std::istream& input) {
 
   auto [text, line_ending] = ReadFirstLine(input);
 
-  std::string_view text_view(text);
   std::optional<long double> wavelength;
   for (;;) {
-    if (text_view.empty()) {
-      if (input.peek() == EOF) {
-        break;
-      }
-
-      if (std::expected<void, std::string> parse_result =
-              ReadNextLine(input, line_ending, text);
-          !parse_result) {
-        return parse_result;
-      }
-
-      text_view = text;
-      continue;
+    if (std::expected<void, std::string> result = HandleLine(text, wavelength);
+        !result) {
+      return result;
     }
 
-    for (std::optional<std::string_view> token = ReadNextToken(text_view);
-         token.has_value(); token = ReadNextToken(text_view)) {
-      if ((*token)[0] == '#') {
-        token->remove_prefix(1);
-        if (std::expected<void, std::string> result = HandleComment(*token);
-            !result) {
-          return result;
-        }
-
-        continue;
-      }
-
-      long double value;
-      if (std::from_chars(token->data(), token->data() + token->size(), value)
-              .ec != std::errc{}) {
-        return std::unexpected("The input contained an unparsable token");
-      }
-
-      if (!wavelength) {
-        wavelength = value;
-        continue;
-      }
-
-      if (std::expected<void, std::string> result =
-              HandleSample(*wavelength, value);
-          !result) {
-        return result;
-      }
+    if (input.peek() == EOF) {
+      break;
+    }
 
-      wavelength.reset();
+    if (std::expected<void, std::string> parse_result =
+            ReadNextLine(input, line_ending, text);
+        !parse_result) {
+      return parse_result;
     }
   }
 
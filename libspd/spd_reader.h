@@ -3,9 +3,12 @@
 
 #include <expected>
 #include <istream>
+#include <optional>
 #include <string>
 #include <string_view>
 
+#include "libspd/spd_tokenizer.h"
+
 namespace libspd {
 
 // The base class for reading SPD files which performs very minimal validation
@@ -18,13 +21,89 @@ class SpdReader {
   // NOTE: Behavior is undefined if input is not a binary stream
   std::expected<void, std::string> ReadFrom(std::istream& input);
 
+  // Parses an SPD file that has already been loaded into memory. This allows
+  // clients to perform file I/O however they see fit (asynchronously, from a
+  // memory mapping, etc.) and then parse the contents without copying them.
+  //
+  // If the derived class implements its handlers as `constexpr`, this may also
+  // be used during constant evaluation. See `internal::ParseFloatConstexpr` for
+  // the restrictions placed on numbers in that case.
+  constexpr std::expected<void, std::string> ReadFrom(std::string_view input) {
+    auto [text, line_ending] = internal::ReadFirstLine(input);
+
+    std::optional<long double> wavelength;
+    for (;;) {
+      if (std::expected<void, std::string> result =
+              HandleLine(text, wavelength);
+          !result) {
+        return result;
+      }
+
+      if (input.empty()) {
+        break;
+      }
+
+      std::expected<std::string_view, std::string> next_line =
+          internal::ReadNextLine(input, line_ending);
+      if (!next_line) {
+        return std::unexpected(std::move(next_line.error()));
+      }
+
+      text = *next_line;
+    }
+
+    if (wavelength.has_value()) {
+      return std::unexpected("The input contained an odd number of tokens");
+    }
+
+    return std::expected<void, std::string>();
+  }
+
  protected:
-  virtual std::expected<void, std::string> HandleComment(
+  virtual constexpr std::expected<void, std::string> HandleComment(
       std::string_view comment) = 0;
-  virtual std::expected<void, std::string> HandleSample(
+  virtual constexpr std::expected<void, std::string> HandleSample(
       long double wavelength, long double spectral_power) = 0;
+
+ private:
+  constexpr std::expected<void, std::string> HandleLine(
+      std::string_view line, std::optional<long double>& wavelength) {
+    for (std::optional<std::string_view> token = internal::ReadNextToken(line);
+         token.has_value(); token = internal::ReadNextToken(line)) {
+      if ((*token)[0] == '#') {
+        token->remove_prefix(1);
+        if (std::expected<void, std::string> result = HandleComment(*token);
+            !result) {
+          return result;
+        }
+
+        continue;
+      }
+
+      std::expected<long double, std::string> value =
+          internal::ParseFloat(*token);
+      if (!value) {
+        return std::unexpected(std::move(value.error()));
+      }
+
+      if (!wavelength) {
+        wavelength = *value;
+        continue;
+      }
+
+      if (std::expected<void, std::string> result =
+              HandleSample(*wavelength, *value);
+          !result) {
+        return result;
+      }
+
+      wavelength.reset();
+    }
+
+    return std::expected<void, std::string>();
+  }
 };
 
 }  // namespace libspd
 
-#endif  // _LIBSPD_SPD_READER_
\ No newline at end of file
+#endif  // _LIBSPD_SPD_READER_
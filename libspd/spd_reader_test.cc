@@ -1,6 +1,9 @@
 #include "libspd/spd_reader.h"
 
 #include <fstream>
+#include <iterator>
+#include <locale>
+#include <stdexcept>
 
 #include "googlemock/include/gmock/gmock.h"
 #include "googletest/include/gtest/gtest.h"
@@ -29,6 +32,12 @@ std::ifstream OpenRunfile(const std::string& filename) {
                        std::ios::in | std::ios::binary);
 }
 
+std::string ReadRunfile(const std::string& filename) {
+  std::ifstream input = OpenRunfile(filename);
+  return std::string(std::istreambuf_iterator<char>(input),
+                     std::istreambuf_iterator<char>());
+}
+
 TEST(SpdReader, BadStream) {
   std::ifstream input = OpenRunfile("notarealfile.spd");
 
@@ -202,5 +211,129 @@ TEST(SpdReader, ValidWindows) {
   EXPECT_TRUE(spd_reader.ReadFrom(input));
 }
 
+TEST(SpdReader, MismatchedLineEndingsFromString) {
+  std::string input = ReadRunfile("mismatched_line_endings.spd");
+
+  MockSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(" Line Ending in CR"))
+      .WillOnce(Return(std::expected<void, std::string>()));
+  EXPECT_CALL(spd_reader, HandleSample(_, _)).Times(0);
+  EXPECT_EQ("The input contained mismatched line endings",
+            spd_reader.ReadFrom(std::string_view(input)).error());
+}
+
+TEST(SpdReader, OddNumberOfTokensFromString) {
+  MockSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_, _)).Times(0);
+  EXPECT_EQ("The input contained an odd number of tokens",
+            spd_reader.ReadFrom(std::string_view("1.0")).error());
+}
+
+TEST(SpdReader, EmptyFromString) {
+  MockSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_, _)).Times(0);
+  EXPECT_TRUE(spd_reader.ReadFrom(std::string_view()));
+}
+
+TEST(SpdReader, RawWithCommentsFromString) {
+  std::string input = ReadRunfile("raw_with_comments.spd");
+
+  MockSpdReader spd_reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(spd_reader, HandleComment(""))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleComment("Comment"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(0.125, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleComment("2.0"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(-1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(0.125, 3.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleComment("3.0 #"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(spd_reader.ReadFrom(std::string_view(input)));
+}
+
+TEST(SpdReader, ValidWindowsFromString) {
+  std::string input = ReadRunfile("valid_windows.spd");
+
+  MockSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(spd_reader, HandleSample(1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(3.0, 4.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(spd_reader.ReadFrom(std::string_view(input)));
+}
+
+TEST(SpdReader, HighBitToken) {
+  std::ifstream input = OpenRunfile("high_bit_token.spd");
+
+  MockSpdReader spd_reader;
+  EXPECT_CALL(spd_reader, HandleComment(_)).Times(0);
+  EXPECT_CALL(spd_reader, HandleSample(_, _)).Times(0);
+  EXPECT_EQ("The input contained an unparsable token",
+            spd_reader.ReadFrom(input).error());
+}
+
+TEST(SpdReader, HighBitComment) {
+  std::ifstream input = OpenRunfile("high_bit_comment.spd");
+
+  MockSpdReader spd_reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(spd_reader, HandleComment("Comment \xC2\xB5m"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleComment("\xFF"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(spd_reader.ReadFrom(input));
+}
+
+TEST(SpdReader, IgnoresGlobalLocale) {
+  std::locale previous;
+  try {
+    previous = std::locale::global(std::locale("C.UTF-8"));
+  } catch (const std::runtime_error&) {
+    GTEST_SKIP() << "C.UTF-8 locale is not available";
+  }
+
+  std::string input = ReadRunfile("high_bit_comment.spd");
+
+  MockSpdReader spd_reader;
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(spd_reader, HandleComment("Comment \xC2\xB5m"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleSample(1.0, 2.0))
+        .WillOnce(Return(std::expected<void, std::string>()));
+    EXPECT_CALL(spd_reader, HandleComment("\xFF"))
+        .WillOnce(Return(std::expected<void, std::string>()));
+  }
+
+  EXPECT_TRUE(spd_reader.ReadFrom(std::string_view(input)));
+
+  std::locale::global(previous);
+}
+
 }  // namespace
 }  // namespace libspd
\ No newline at end of file
@@ -0,0 +1,327 @@
+#ifndef _LIBSPD_SPD_TOKENIZER_
+#define _LIBSPD_SPD_TOKENIZER_
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// The building blocks used by `SpdReader` for splitting an SPD file into lines
+// and tokens. Everything in this file is usable during constant evaluation so
+// that SPD files can be parsed at compile time using the same rules as at
+// runtime. Clients should not need to use this file directly.
+
+namespace libspd {
+namespace internal {
+
+// Classifies each byte as either part of a token or as a separator. For ASCII
+// this matches `std::isgraph` in the "C" locale; however, unlike
+// `std::isgraph` the result does not depend on the current locale and is well
+// defined for every byte. Bytes outside of the ASCII range are always treated
+// as part of a token so that they are either preserved in comments or rejected
+// as unparsable.
+inline constexpr std::array<bool, 256> kIsTokenCharacter = [] {
+  std::array<bool, 256> result = {};
+  for (size_t i = 0; i < result.size(); i++) {
+    result[i] = i > 0x20 && i != 0x7F;
+  }
+  return result;
+}();
+
+constexpr bool IsTokenCharacter(char c) {
+  return kIsTokenCharacter[static_cast<unsigned char>(c)];
+}
+
+constexpr std::pair<std::string_view, std::string_view> ReadFirstLine(
+    std::string_view& input) {
+  size_t text_length = input.find_first_of("\r\n");
+  if (text_length == std::string_view::npos) {
+    std::string_view text;
+    std::swap(text, input);
+    return std::make_pair(text, std::string_view());
+  }
+
+  size_t line_ending_length = 1;
+  if (input[text_length] == '\r' && text_length + 1 < input.size() &&
+      input[text_length + 1] == '\n') {
+    line_ending_length = 2;
+  }
+
+  std::string_view text = input.substr(0, text_length);
+  std::string_view line_ending = input.substr(text_length, line_ending_length);
+  input.remove_prefix(text_length + line_ending_length);
+
+  return std::make_pair(text, line_ending);
+}
+
+constexpr std::expected<std::string_view, std::string> ReadNextLine(
+    std::string_view& input, std::string_view line_ending) {
+  std::string_view text = input.substr(0, input.find_first_of("\r\n"));
+  input.remove_prefix(text.size());
+
+  for (char c : line_ending) {
+    if (input.empty()) {
+      break;
+    }
+
+    if (input.front() != c) {
+      return std::unexpected("The input contained mismatched line endings");
+    }
+
+    input.remove_prefix(1);
+  }
+
+  return text;
+}
+
+constexpr std::optional<std::string_view> ReadNextToken(
+    std::string_view& text) {
+  while (!text.empty()) {
+    if (IsTokenCharacter(text.front())) {
+      break;
+    }
+
+    text.remove_prefix(1);
+  }
+
+  if (text.empty()) {
+    return std::nullopt;
+  }
+
+  if (text.front() == '#') {
+    std::string_view result;
+    std::swap(result, text);
+    return result;
+  }
+
+  size_t token_length;
+  for (token_length = 1; token_length < text.size(); token_length++) {
+    if (!IsTokenCharacter(text[token_length]) || text[token_length] == '#') {
+      break;
+    }
+  }
+
+  std::string_view result = text.substr(0, token_length);
+  text.remove_prefix(token_length);
+
+  return result;
+}
+
+// Parses the longest prefix of `token` that forms a number in the same format
+// accepted by `std::from_chars`. Since `std::from_chars` cannot be used during
+// constant evaluation, this function only accepts numbers that can be
+// converted to a correctly rounded `long double` with a single multiplication
+// or division by an exactly representable power of ten. In practice this
+// covers every value found in real SPD files; any other value is rejected
+// rather than risk producing a different result than at runtime.
+//
+// If `length` is not null, the length of the prefix that was parsed is
+// written to it on success.
+constexpr std::expected<long double, std::string> ParseFloatConstexpr(
+    std::string_view token, size_t* length = nullptr) {
+  constexpr uint64_t kMaxExactMantissa =
+      std::numeric_limits<long double>::digits >= 64
+          ? std::numeric_limits<uint64_t>::max()
+          : (static_cast<uint64_t>(1)
+             << std::numeric_limits<long double>::digits) -
+                1;
+
+  constexpr int64_t kMaxExactPowerOfTen = [] {
+    int64_t result = 0;
+    for (uint64_t power = 1; power <= kMaxExactMantissa / 5; power *= 5) {
+      result += 1;
+    }
+    return result;
+  }();
+
+  constexpr int kMaxSignificantDigits =
+      std::numeric_limits<uint64_t>::digits10;
+
+  auto is_digit = [&](size_t index) {
+    return index < token.size() && '0' <= token[index] && token[index] <= '9';
+  };
+
+  auto starts_with_ignoring_case = [&](size_t index, std::string_view word) {
+    if (token.size() - index < word.size()) {
+      return false;
+    }
+
+    for (size_t i = 0; i < word.size(); i++) {
+      char c = token[index + i];
+      if (c != word[i] && c != word[i] - 'a' + 'A') {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  size_t index = 0;
+  bool negative = false;
+  if (index < token.size() && token[index] == '-') {
+    negative = true;
+    index += 1;
+  }
+
+  auto parsed = [&](size_t end, long double value) {
+    if (length != nullptr) {
+      *length = end;
+    }
+    return value;
+  };
+
+  if (starts_with_ignoring_case(index, "inf")) {
+    long double infinity = std::numeric_limits<long double>::infinity();
+    return parsed(starts_with_ignoring_case(index, "infinity") ? index + 8
+                                                               : index + 3,
+                  negative ? -infinity : infinity);
+  }
+
+  if (starts_with_ignoring_case(index, "nan")) {
+    index += 3;
+
+    // An optional sequence of letters, digits and underscores in parentheses
+    size_t end = index;
+    if (end < token.size() && token[end] == '(') {
+      for (end += 1; end < token.size() &&
+                     (('0' <= token[end] && token[end] <= '9') ||
+                      ('a' <= token[end] && token[end] <= 'z') ||
+                      ('A' <= token[end] && token[end] <= 'Z') ||
+                      token[end] == '_');
+           end++) {
+      }
+
+      if (end < token.size() && token[end] == ')') {
+        index = end + 1;
+      }
+    }
+
+    return parsed(index, std::numeric_limits<long double>::quiet_NaN());
+  }
+
+  uint64_t mantissa = 0;
+  int significant_digits = 0;
+  int64_t exponent = 0;
+  bool has_digits = false;
+  bool exact = true;
+
+  for (; is_digit(index); index++) {
+    has_digits = true;
+
+    int digit = token[index] - '0';
+    if (mantissa == 0 && digit == 0) {
+      continue;
+    }
+
+    if (significant_digits < kMaxSignificantDigits) {
+      mantissa = mantissa * 10 + digit;
+      significant_digits += 1;
+    } else {
+      exponent += 1;
+      exact = exact && digit == 0;
+    }
+  }
+
+  if (index < token.size() && token[index] == '.') {
+    for (index += 1; is_digit(index); index++) {
+      has_digits = true;
+
+      int digit = token[index] - '0';
+      if (mantissa == 0 && digit == 0) {
+        exponent -= 1;
+        continue;
+      }
+
+      if (significant_digits < kMaxSignificantDigits) {
+        mantissa = mantissa * 10 + digit;
+        significant_digits += 1;
+        exponent -= 1;
+      } else {
+        exact = exact && digit == 0;
+      }
+    }
+  }
+
+  if (!has_digits) {
+    return std::unexpected("The input contained an unparsable token");
+  }
+
+  if (index < token.size() && (token[index] == 'e' || token[index] == 'E')) {
+    size_t exponent_index = index + 1;
+
+    bool negative_exponent = false;
+    if (exponent_index < token.size() &&
+        (token[exponent_index] == '-' || token[exponent_index] == '+')) {
+      negative_exponent = token[exponent_index] == '-';
+      exponent_index += 1;
+    }
+
+    // The exponent is only part of the number if it contains a digit
+    if (is_digit(exponent_index)) {
+      int64_t explicit_exponent = 0;
+      for (; is_digit(exponent_index); exponent_index++) {
+        if (explicit_exponent < std::numeric_limits<int32_t>::max()) {
+          explicit_exponent =
+              explicit_exponent * 10 + (token[exponent_index] - '0');
+        }
+      }
+
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+      index = exponent_index;
+    }
+  }
+
+  if (mantissa == 0) {
+    return parsed(index, negative ? -0.0L : 0.0L);
+  }
+
+  if (!exact || mantissa > kMaxExactMantissa ||
+      exponent > kMaxExactPowerOfTen || exponent < -kMaxExactPowerOfTen) {
+    return std::unexpected(
+        "The input contained a token that cannot be parsed exactly at compile "
+        "time");
+  }
+
+  long double power_of_ten = 1.0L;
+  for (int64_t i = 0; i < exponent || i < -exponent; i++) {
+    power_of_ten *= 10.0L;
+  }
+
+  long double value = static_cast<long double>(mantissa);
+  value = (exponent < 0) ? value / power_of_ten : value * power_of_ten;
+
+  return parsed(index, negative ? -value : value);
+}
+
+// Parses the longest prefix of `token` that forms a number. If `length` is not
+// null, the length of that prefix is written to it on success.
+constexpr std::expected<long double, std::string> ParseFloat(
+    std::string_view token, size_t* length = nullptr) {
+  if !consteval {
+    long double value;
+    std::from_chars_result result =
+        std::from_chars(token.data(), token.data() + token.size(), value);
+    if (result.ec != std::errc{}) {
+      return std::unexpected("The input contained an unparsable token");
+    }
+
+    if (length != nullptr) {
+      *length = static_cast<size_t>(result.ptr - token.data());
+    }
+
+    return value;
+  }
+
+  return ParseFloatConstexpr(token, length);
+}
+
+}  // namespace internal
+}  // namespace libspd
+
+#endif  // _LIBSPD_SPD_TOKENIZER_
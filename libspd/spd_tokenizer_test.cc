@@ -0,0 +1,125 @@
+#include "libspd/spd_tokenizer.h"
+
+#include <charconv>
+#include <cmath>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace internal {
+namespace {
+
+long double FromChars(std::string_view token) {
+  long double value;
+  EXPECT_EQ(std::errc{},
+            std::from_chars(token.data(), token.data() + token.size(), value)
+                .ec);
+  return value;
+}
+
+TEST(IsTokenCharacter, Ascii) {
+  EXPECT_FALSE(IsTokenCharacter('\0'));
+  EXPECT_FALSE(IsTokenCharacter('\t'));
+  EXPECT_FALSE(IsTokenCharacter(' '));
+  EXPECT_FALSE(IsTokenCharacter('\x7F'));
+  EXPECT_TRUE(IsTokenCharacter('!'));
+  EXPECT_TRUE(IsTokenCharacter('#'));
+  EXPECT_TRUE(IsTokenCharacter('0'));
+  EXPECT_TRUE(IsTokenCharacter('~'));
+}
+
+TEST(IsTokenCharacter, HighBit) {
+  for (int c = 0x80; c <= 0xFF; c++) {
+    EXPECT_TRUE(IsTokenCharacter(static_cast<char>(c)));
+  }
+}
+
+TEST(ReadNextToken, SplitsTokens) {
+  std::string_view text = " 1.0\t2.0#comment";
+  EXPECT_EQ("1.0", ReadNextToken(text));
+  EXPECT_EQ("2.0", ReadNextToken(text));
+  EXPECT_EQ("#comment", ReadNextToken(text));
+  EXPECT_EQ(std::nullopt, ReadNextToken(text));
+}
+
+TEST(ParseFloatConstexpr, MatchesFromChars) {
+  for (std::string_view token :
+       {"0", "-0", "1", "-1", "0.125", "380", "380.5", "0.1", "0.7", "5.",
+        ".5", "1e3", "1E3", "1.5e-3", "2.5e+2", "1e", "1e-", "1.0abc",
+        "0.000001", "780.0000000000000000000000", "123456789.123456789",
+        "1234567890123456789", "1e27", "3e-27", "0.333333333333333333"}) {
+    std::expected<long double, std::string> value =
+        ParseFloatConstexpr(token);
+    ASSERT_TRUE(value) << token;
+    EXPECT_EQ(FromChars(token), *value) << token;
+    EXPECT_EQ(std::signbit(FromChars(token)), std::signbit(*value)) << token;
+  }
+}
+
+TEST(ParseFloatConstexpr, LengthMatchesFromChars) {
+  for (std::string_view token :
+       {"1", "-0.5", "1e3", "1e", "1e-", "1.5e+2x", "1.0abc", "1,5", "1nm",
+        "inf", "-infinity", "infinit", "nan", "nan(1_a)", "nan(", "nan()x"}) {
+    long double value;
+    std::from_chars_result expected =
+        std::from_chars(token.data(), token.data() + token.size(), value);
+    ASSERT_EQ(std::errc{}, expected.ec) << token;
+
+    size_t length = 0;
+    ASSERT_TRUE(ParseFloatConstexpr(token, &length)) << token;
+    EXPECT_EQ(static_cast<size_t>(expected.ptr - token.data()), length)
+        << token;
+  }
+}
+
+TEST(ParseFloatConstexpr, NonFinite) {
+  EXPECT_TRUE(std::isinf(*ParseFloatConstexpr("inf")));
+  EXPECT_TRUE(std::isinf(*ParseFloatConstexpr("-INFINITY")));
+  EXPECT_LT(*ParseFloatConstexpr("-inf"), 0.0L);
+  EXPECT_TRUE(std::isnan(*ParseFloatConstexpr("NaN")));
+}
+
+TEST(ParseFloatConstexpr, Unparsable) {
+  for (std::string_view token : {"", "-", ".", "+1", "e5", "notafloat"}) {
+    EXPECT_EQ("The input contained an unparsable token",
+              ParseFloatConstexpr(token).error())
+        << token;
+  }
+}
+
+TEST(ParseFloatConstexpr, Inexact) {
+  for (std::string_view token :
+       {"1e40", "1e-40", "12345678901234567891", "0.12345678901234567891"}) {
+    EXPECT_EQ(
+        "The input contained a token that cannot be parsed exactly at "
+        "compile time",
+        ParseFloatConstexpr(token).error())
+        << token;
+  }
+}
+
+TEST(ParseFloat, ConstantEvaluation) {
+  static_assert(*ParseFloat("0.125") == 0.125L);
+  static_assert(*ParseFloat("-2.5e2") == -250.0L);
+  static_assert(!ParseFloat("notafloat"));
+}
+
+TEST(ParseFloat, Length) {
+  size_t length = 0;
+  EXPECT_EQ(1.0L, *ParseFloat("1,5", &length));
+  EXPECT_EQ(1u, length);
+  EXPECT_EQ(400.0L, *ParseFloat("400nm", &length));
+  EXPECT_EQ(3u, length);
+}
+
+TEST(ParseFloat, Runtime) {
+  EXPECT_EQ(0.1L, *ParseFloat("0.1"));
+  EXPECT_EQ(1e40L, *ParseFloat("1e40"));
+  EXPECT_EQ("The input contained an unparsable token",
+            ParseFloat("notafloat").error());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace libspd
@@ -0,0 +1,144 @@
+#include "libspd/spd_watcher.h"
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "libspd/errno_error.h"
+
+namespace libspd {
+namespace internal {
+
+std::expected<std::unique_ptr<FileWatcher>, std::string> FileWatcher::Create(
+    Callback on_change) {
+  int inotify_fd = inotify_init1(IN_CLOEXEC);
+  if (inotify_fd < 0) {
+    return ErrnoError("inotify_init1");
+  }
+
+  int stop_fd = eventfd(0, EFD_CLOEXEC);
+  if (stop_fd < 0) {
+    auto error = ErrnoError("eventfd");
+    close(inotify_fd);
+    return error;
+  }
+
+  return std::unique_ptr<FileWatcher>(
+      new FileWatcher(inotify_fd, stop_fd, std::move(on_change)));
+}
+
+FileWatcher::FileWatcher(int inotify_fd, int stop_fd, Callback on_change)
+    : inotify_fd_(inotify_fd),
+      stop_fd_(stop_fd),
+      on_change_(std::move(on_change)),
+      thread_(&FileWatcher::Run, this) {}
+
+FileWatcher::~FileWatcher() {
+  uint64_t value = 1;
+  while (write(stop_fd_, &value, sizeof(value)) < 0 && errno == EINTR) {
+  }
+
+  thread_.join();
+
+  close(stop_fd_);
+  close(inotify_fd_);
+}
+
+std::expected<void, std::string> FileWatcher::Watch(const std::string& path) {
+  std::filesystem::path file(path);
+
+  std::filesystem::path directory = file.parent_path();
+  if (directory.empty()) {
+    directory = ".";
+  }
+
+  std::string name = file.filename().string();
+  if (name.empty()) {
+    return std::unexpected("The path does not name a file: " + path);
+  }
+
+  int wd = inotify_add_watch(inotify_fd_, directory.c_str(),
+                             IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (wd < 0) {
+    return ErrnoError("inotify_add_watch");
+  }
+
+  std::lock_guard lock(mutex_);
+  auto key = std::make_pair(wd, std::move(name));
+  auto [begin, end] = files_.equal_range(key);
+  if (std::find_if(begin, end, [&](const auto& entry) {
+        return entry.second == path;
+      }) == end) {
+    files_.emplace(std::move(key), path);
+  }
+
+  return std::expected<void, std::string>();
+}
+
+void FileWatcher::Run() {
+  alignas(inotify_event) char buffer[4096];
+
+  for (;;) {
+    pollfd fds[2] = {{stop_fd_, POLLIN, 0}, {inotify_fd_, POLLIN, 0}};
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      return;
+    }
+
+    if (fds[0].revents != 0) {
+      return;
+    }
+
+    if (fds[1].revents == 0) {
+      continue;
+    }
+
+    ssize_t length = read(inotify_fd_, buffer, sizeof(buffer));
+    if (length <= 0) {
+      continue;
+    }
+
+    for (ssize_t offset = 0; offset < length;) {
+      const inotify_event* event =
+          reinterpret_cast<const inotify_event*>(buffer + offset);
+      offset += sizeof(inotify_event) + event->len;
+
+      // More than one path may refer to the same file
+      std::vector<std::string> paths;
+      if (event->mask & IN_Q_OVERFLOW) {
+        // Events were dropped, so any of the files may have changed
+        std::lock_guard lock(mutex_);
+        for (const auto& [key, path] : files_) {
+          paths.push_back(path);
+        }
+
+        std::sort(paths.begin(), paths.end());
+        paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+      } else if (event->len != 0) {
+        std::lock_guard lock(mutex_);
+        auto [begin, end] = files_.equal_range(
+            std::make_pair(event->wd, std::string(event->name)));
+        for (auto iter = begin; iter != end; ++iter) {
+          paths.push_back(iter->second);
+        }
+      }
+
+      for (const std::string& path : paths) {
+        on_change_(path);
+      }
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace libspd
@@ -0,0 +1,198 @@
+#ifndef _LIBSPD_SPD_WATCHER_
+#define _LIBSPD_SPD_WATCHER_
+
+#include <atomic>
+#include <concepts>
+#include <expected>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace libspd {
+namespace internal {
+
+// Watches a set of files using inotify and calls `on_change` from a
+// background thread each time one of them is rewritten or replaced. The
+// directory containing each file is watched rather than the file itself so
+// that files saved by writing a new file and renaming it over the old one are
+// still noticed. If the kernel's event queue overflows, `on_change` is called
+// for every watched file since any of their events may have been dropped.
+class FileWatcher {
+ public:
+  using Callback = std::function<void(const std::string& path)>;
+
+  static std::expected<std::unique_ptr<FileWatcher>, std::string> Create(
+      Callback on_change);
+
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+  ~FileWatcher();
+
+  std::expected<void, std::string> Watch(const std::string& path);
+
+ private:
+  FileWatcher(int inotify_fd, int stop_fd, Callback on_change);
+
+  void Run();
+
+  int inotify_fd_;
+  int stop_fd_;
+  Callback on_change_;
+
+  std::mutex mutex_;
+  std::multimap<std::pair<int, std::string>, std::string> files_;
+
+  std::thread thread_;
+};
+
+}  // namespace internal
+
+// A set of SPD files that are reloaded whenever they change on disk. Each
+// change only causes the file that changed to be parsed again, and the new
+// samples are then published atomically so that threads reading the samples
+// never wait on a reload.
+//
+// If a file fails to reload, the samples that were last loaded successfully
+// remain published. The outcome of every reload is reported to the callback
+// passed at creation, which is invoked from a background thread.
+template <std::floating_point Type>
+class SpdWatcher {
+ public:
+  using Parser = std::function<std::expected<std::map<Type, Type>, std::string>(
+      std::istream& input)>;
+  using Callback = std::function<void(
+      const std::string& path, const std::expected<void, std::string>& result)>;
+
+  // The most recently loaded samples of a watched file
+  class WatchedSpd {
+   public:
+    std::shared_ptr<const std::map<Type, Type>> Load() const {
+      return samples_.load(std::memory_order_acquire);
+    }
+
+   private:
+    friend class SpdWatcher;
+
+    std::atomic<std::shared_ptr<const std::map<Type, Type>>> samples_;
+  };
+
+  // `parser` is used to read each file. For instance:
+  //
+  //   SpdWatcher<float>::Create(
+  //       [](std::istream& input) {
+  //         return ReadEmissiveSpdFrom<float>(input);
+  //       },
+  //       on_reload);
+  static std::expected<std::unique_ptr<SpdWatcher>, std::string> Create(
+      Parser parser, Callback on_reload) {
+    std::unique_ptr<SpdWatcher> result(
+        new SpdWatcher(std::move(parser), std::move(on_reload)));
+
+    auto file_watcher = internal::FileWatcher::Create(
+        [watcher = result.get()](const std::string& path) {
+          watcher->Reload(path);
+        });
+    if (!file_watcher) {
+      return std::unexpected(std::move(file_watcher.error()));
+    }
+
+    result->file_watcher_ = std::move(*file_watcher);
+
+    return result;
+  }
+
+  SpdWatcher(const SpdWatcher&) = delete;
+  SpdWatcher& operator=(const SpdWatcher&) = delete;
+
+  // Loads the file at `path` and starts watching it for changes. Watching the
+  // same path more than once returns the same `WatchedSpd`.
+  std::expected<std::shared_ptr<const WatchedSpd>, std::string> Watch(
+      const std::string& path) {
+    std::lock_guard lock(mutex_);
+
+    if (auto iter = files_.find(path); iter != files_.end()) {
+      return iter->second;
+    }
+
+    // The watch is added before the file is first read so that no change made
+    // after reading it can be missed
+    if (auto watched = file_watcher_->Watch(path); !watched) {
+      return std::unexpected(std::move(watched.error()));
+    }
+
+    auto samples = Parse(path);
+    if (!samples) {
+      return std::unexpected(std::move(samples.error()));
+    }
+
+    auto result = std::make_shared<WatchedSpd>();
+    result->samples_.store(std::move(*samples), std::memory_order_release);
+    files_[path] = result;
+
+    return result;
+  }
+
+ private:
+  SpdWatcher(Parser parser, Callback on_reload)
+      : parser_(std::move(parser)), on_reload_(std::move(on_reload)) {}
+
+  std::expected<std::shared_ptr<const std::map<Type, Type>>, std::string> Parse(
+      const std::string& path) {
+    std::ifstream input(path, std::ios::in | std::ios::binary);
+    if (!input) {
+      return std::unexpected("Failed to open " + path);
+    }
+
+    auto samples = parser_(input);
+    if (!samples) {
+      return std::unexpected(std::move(samples.error()));
+    }
+
+    return std::make_shared<const std::map<Type, Type>>(std::move(*samples));
+  }
+
+  void Reload(const std::string& path) {
+    std::expected<void, std::string> result;
+    {
+      std::lock_guard lock(mutex_);
+
+      auto iter = files_.find(path);
+      if (iter == files_.end()) {
+        return;
+      }
+
+      auto samples = Parse(path);
+      if (samples) {
+        iter->second->samples_.store(std::move(*samples),
+                                     std::memory_order_release);
+      } else {
+        result = std::unexpected(std::move(samples.error()));
+      }
+    }
+
+    if (on_reload_) {
+      on_reload_(path, result);
+    }
+  }
+
+  Parser parser_;
+  Callback on_reload_;
+
+  // Serializes loading files; never held by threads reading samples
+  std::mutex mutex_;
+  std::map<std::string, std::shared_ptr<WatchedSpd>> files_;
+
+  // Declared last so that its thread is stopped before anything it uses is
+  // destroyed
+  std::unique_ptr<internal::FileWatcher> file_watcher_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_SPD_WATCHER_
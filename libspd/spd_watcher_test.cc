@@ -0,0 +1,212 @@
+#include "libspd/spd_watcher.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <vector>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+#include "libspd/readers/emissive_spd_reader.h"
+#include "libspd/temp_directory_test_fixture.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+class SpdWatcherTest : public TempDirectoryTest {
+ protected:
+  std::unique_ptr<SpdWatcher<float>> CreateWatcher() {
+    auto result = SpdWatcher<float>::Create(
+        [this](std::istream& input) {
+          parses_ += 1;
+          return ReadEmissiveSpdFrom<float>(input);
+        },
+        [this](const std::string& path,
+               const std::expected<void, std::string>& result) {
+          if (before_reload_) {
+            before_reload_();
+          }
+
+          std::lock_guard lock(mutex_);
+          reloads_.emplace_back(path, result ? "" : result.error());
+          condition_.notify_all();
+        });
+    EXPECT_TRUE(result);
+    return std::move(*result);
+  }
+
+  // Returns the first `count` reloads, or fewer if they take too long
+  std::vector<std::pair<std::string, std::string>> WaitForReloads(
+      size_t count) {
+    std::unique_lock lock(mutex_);
+    condition_.wait_for(lock, std::chrono::seconds(10),
+                        [&] { return reloads_.size() >= count; });
+    return reloads_;
+  }
+
+  std::atomic<int> parses_ = 0;
+  std::function<void()> before_reload_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<std::pair<std::string, std::string>> reloads_;
+};
+
+TEST_F(SpdWatcherTest, LoadsInitialContents) {
+  WriteFile("a.spd", "1.0 2.0");
+
+  auto watcher = CreateWatcher();
+  auto watched = watcher->Watch(Path("a.spd"));
+  ASSERT_TRUE(watched);
+  EXPECT_THAT(*(*watched)->Load(), ElementsAre(Pair(1.0f, 2.0f)));
+}
+
+TEST_F(SpdWatcherTest, MissingFile) {
+  auto watcher = CreateWatcher();
+  auto watched = watcher->Watch(Path("missing.spd"));
+  ASSERT_FALSE(watched);
+  EXPECT_EQ("Failed to open " + Path("missing.spd"), watched.error());
+}
+
+TEST_F(SpdWatcherTest, MalformedFile) {
+  WriteFile("a.spd", "1.0");
+
+  auto watcher = CreateWatcher();
+  auto watched = watcher->Watch(Path("a.spd"));
+  ASSERT_FALSE(watched);
+  EXPECT_EQ("The input contained an odd number of tokens", watched.error());
+}
+
+TEST_F(SpdWatcherTest, WatchTwice) {
+  WriteFile("a.spd", "1.0 2.0");
+
+  auto watcher = CreateWatcher();
+  auto first = watcher->Watch(Path("a.spd"));
+  auto second = watcher->Watch(Path("a.spd"));
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_EQ(*first, *second);
+  EXPECT_EQ(1, parses_);
+}
+
+TEST_F(SpdWatcherTest, ReloadsChangedFileOnly) {
+  WriteFile("a.spd", "1.0 2.0");
+  WriteFile("b.spd", "3.0 4.0");
+
+  auto watcher = CreateWatcher();
+  auto a = watcher->Watch(Path("a.spd"));
+  auto b = watcher->Watch(Path("b.spd"));
+  ASSERT_TRUE(a);
+  ASSERT_TRUE(b);
+  ASSERT_EQ(2, parses_);
+
+  auto old_b = (*b)->Load();
+
+  WriteFile("b.spd", "5.0 6.0");
+
+  EXPECT_THAT(WaitForReloads(1), ElementsAre(Pair(Path("b.spd"), "")));
+  EXPECT_THAT(*(*a)->Load(), ElementsAre(Pair(1.0f, 2.0f)));
+  EXPECT_THAT(*(*b)->Load(), ElementsAre(Pair(5.0f, 6.0f)));
+  EXPECT_EQ(3, parses_);
+
+  // Snapshots that were already loaded are unaffected
+  EXPECT_THAT(*old_b, ElementsAre(Pair(3.0f, 4.0f)));
+}
+
+TEST_F(SpdWatcherTest, ReloadsRenamedFile) {
+  WriteFile("a.spd", "1.0 2.0");
+
+  auto watcher = CreateWatcher();
+  auto watched = watcher->Watch(Path("a.spd"));
+  ASSERT_TRUE(watched);
+
+  WriteFile("a.spd.tmp", "3.0 4.0");
+  std::filesystem::rename(Path("a.spd.tmp"), Path("a.spd"));
+
+  EXPECT_THAT(WaitForReloads(1), ElementsAre(Pair(Path("a.spd"), "")));
+  EXPECT_THAT(*(*watched)->Load(), ElementsAre(Pair(3.0f, 4.0f)));
+}
+
+TEST_F(SpdWatcherTest, FailedReloadKeepsPreviousSamples) {
+  WriteFile("a.spd", "1.0 2.0");
+
+  auto watcher = CreateWatcher();
+  auto watched = watcher->Watch(Path("a.spd"));
+  ASSERT_TRUE(watched);
+
+  WriteFile("a.spd", "1.0");
+
+  EXPECT_THAT(WaitForReloads(1),
+              ElementsAre(Pair(Path("a.spd"),
+                               "The input contained an odd number of tokens")));
+  EXPECT_THAT(*(*watched)->Load(), ElementsAre(Pair(1.0f, 2.0f)));
+}
+
+TEST_F(SpdWatcherTest, IgnoresUnwatchedFiles) {
+  WriteFile("a.spd", "1.0 2.0");
+
+  auto watcher = CreateWatcher();
+  auto watched = watcher->Watch(Path("a.spd"));
+  ASSERT_TRUE(watched);
+
+  WriteFile("b.spd", "3.0 4.0");
+  WriteFile("a.spd", "5.0 6.0");
+
+  EXPECT_THAT(WaitForReloads(1), ElementsAre(Pair(Path("a.spd"), "")));
+  EXPECT_EQ(2, parses_);
+}
+
+TEST_F(SpdWatcherTest, ReloadsEverythingOnOverflow) {
+  size_t max_queued_events = 0;
+  std::ifstream limit("/proc/sys/fs/inotify/max_queued_events");
+  if (!(limit >> max_queued_events)) {
+    GTEST_SKIP() << "The inotify queue limit is unknown";
+  }
+
+  WriteFile("a.spd", "1.0 2.0");
+  WriteFile("b.spd", "3.0 4.0");
+
+  // Stalls the watcher thread in the first reload so that events queue up
+  std::promise<void> stalled;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<bool> first = true;
+  before_reload_ = [&]() {
+    if (first.exchange(false)) {
+      stalled.set_value();
+      released.wait();
+    }
+  };
+
+  auto watcher = CreateWatcher();
+  auto a = watcher->Watch(Path("a.spd"));
+  auto b = watcher->Watch(Path("b.spd"));
+  ASSERT_TRUE(a);
+  ASSERT_TRUE(b);
+
+  WriteFile("a.spd", "5.0 6.0");
+  stalled.get_future().wait();
+
+  // Alternate between two files so that the events are not coalesced
+  for (size_t i = 0; i <= max_queued_events; i++) {
+    WriteFile(i % 2 == 0 ? "x.spd" : "y.spd", "");
+  }
+
+  // This change is dropped by the kernel since the queue is full
+  WriteFile("b.spd", "7.0 8.0");
+  release.set_value();
+
+  WaitForReloads(3);
+  EXPECT_THAT(*(*a)->Load(), ElementsAre(Pair(5.0f, 6.0f)));
+  EXPECT_THAT(*(*b)->Load(), ElementsAre(Pair(7.0f, 8.0f)));
+}
+
+}  // namespace
+}  // namespace libspd
@@ -0,0 +1,243 @@
+#ifndef _LIBSPD_SPECTRUM_SET_
+#define _LIBSPD_SPECTRUM_SET_
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace libspd {
+
+// An immutable collection of spectra stored contiguously for fast batched
+// evaluation. Each spectrum's wavelengths and spectral powers are stored in
+// two parallel arrays that start on a cache line boundary, so that evaluating
+// many spectra at the same handful of wavelengths touches as little memory as
+// possible.
+//
+// Spectra are evaluated by linearly interpolating between the two samples
+// surrounding a wavelength. Wavelengths outside of the range sampled by a
+// spectrum evaluate to zero.
+//
+// NOTE: Behavior is undefined if a spectrum contains 2^32 or more samples
+template <std::floating_point Type>
+class SpectrumSet {
+ public:
+  SpectrumSet() = default;
+
+  explicit SpectrumSet(std::span<const std::map<Type, Type>> spectra) {
+    size_t total_size = 0;
+    for (const std::map<Type, Type>& spectrum : spectra) {
+      ranges_.emplace_back(total_size, spectrum.size());
+      total_size += Pad(spectrum.size() + 1);
+    }
+
+    wavelengths_.resize(total_size);
+    spectral_powers_.resize(total_size);
+
+    for (size_t i = 0; i < spectra.size(); i++) {
+      size_t index = ranges_[i].first;
+      for (const auto& [wavelength, spectral_power] : spectra[i]) {
+        wavelengths_[index] = wavelength;
+        spectral_powers_[index] = spectral_power;
+        index += 1;
+      }
+
+      if (!spectra[i].empty()) {
+        wavelengths_[index] = std::numeric_limits<Type>::infinity();
+        spectral_powers_[index] = spectra[i].rbegin()->second;
+      }
+
+      spacings_.push_back(UniformSpacing(i));
+    }
+  }
+
+  size_t size() const { return ranges_.size(); }
+
+  // Evaluates every spectrum in the set at each of the wavelengths passed.
+  // The value of spectrum `i` at `wavelengths[k]` is written to
+  // `output[i * wavelengths.size() + k]`.
+  //
+  // NOTE: Behavior is undefined if output is smaller than
+  // size() * wavelengths.size()
+  void Evaluate(std::span<const Type> wavelengths,
+                std::span<Type> output) const {
+    // The wavelengths are split into batches whose sizes are powers of two so
+    // that every batch is evaluated with a fixed number of lanes without
+    // evaluating any padding. For instance, 4 wavelengths are evaluated as a
+    // single batch of 4 and 21 as batches of 16, 4 and 1.
+    size_t offset = 0;
+    EvaluateBatches<kMaxBatchSize>(wavelengths, output, offset);
+    EvaluateBatches<8>(wavelengths, output, offset);
+    EvaluateBatches<4>(wavelengths, output, offset);
+    EvaluateBatches<2>(wavelengths, output, offset);
+    EvaluateBatches<1>(wavelengths, output, offset);
+  }
+
+ private:
+  // The largest number of wavelengths searched for in lockstep. The searches
+  // within a batch all perform the same number of iterations which allows the
+  // compiler to interleave them, or to vectorize across them when targeting
+  // an instruction set with vector gathers (such as AVX2).
+  static constexpr size_t kMaxBatchSize = 16;
+  static constexpr size_t kCacheLineSize = 64;
+
+  template <typename T>
+  struct CacheAlignedAllocator {
+    using value_type = T;
+
+    CacheAlignedAllocator() = default;
+
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+      return static_cast<T*>(::operator new(
+          n * sizeof(T), std::align_val_t(kCacheLineSize)));
+    }
+
+    void deallocate(T* p, size_t n) {
+      ::operator delete(p, n * sizeof(T), std::align_val_t(kCacheLineSize));
+    }
+
+    bool operator==(const CacheAlignedAllocator&) const = default;
+  };
+
+  static size_t Pad(size_t size) {
+    constexpr size_t kValuesPerCacheLine =
+        std::max(static_cast<size_t>(1), kCacheLineSize / sizeof(Type));
+    return (size + kValuesPerCacheLine - 1) / kValuesPerCacheLine *
+           kValuesPerCacheLine;
+  }
+
+  // Returns the spacing of the samples of `spectrum` if dividing the distance
+  // from its first sample by that spacing and rounding down yields the index
+  // of every sample, in which case the samples around a wavelength can be
+  // found without a search. Otherwise returns zero.
+  Type UniformSpacing(size_t spectrum) const {
+    auto [start, num_samples] = ranges_[spectrum];
+    if (num_samples < 2) {
+      return static_cast<Type>(0.0);
+    }
+
+    const Type* sample_wavelengths = wavelengths_.data() + start;
+    Type spacing =
+        (sample_wavelengths[num_samples - 1] - sample_wavelengths[0]) /
+        static_cast<Type>(num_samples - 1);
+    if (!(spacing > static_cast<Type>(0.0)) ||
+        !(spacing < std::numeric_limits<Type>::infinity())) {
+      return static_cast<Type>(0.0);
+    }
+
+    for (size_t j = 0; j < num_samples; j++) {
+      if (static_cast<size_t>((sample_wavelengths[j] - sample_wavelengths[0]) /
+                              spacing) != j) {
+        return static_cast<Type>(0.0);
+      }
+    }
+
+    return spacing;
+  }
+
+  // Evaluates every spectrum at each complete batch of `BatchSize`
+  // wavelengths starting at `offset`, advancing `offset` past them
+  template <size_t BatchSize>
+  void EvaluateBatches(std::span<const Type> wavelengths,
+                       std::span<Type> output, size_t& offset) const {
+    for (; wavelengths.size() - offset >= BatchSize; offset += BatchSize) {
+      for (size_t i = 0; i < ranges_.size(); i++) {
+        EvaluateBatch<BatchSize>(i, wavelengths.data() + offset,
+                                 output.data() + i * wavelengths.size() +
+                                     offset);
+      }
+    }
+  }
+
+  template <size_t BatchSize>
+  void EvaluateBatch(size_t spectrum, const Type* wavelengths,
+                     Type* output) const {
+    auto [start, num_samples] = ranges_[spectrum];
+
+    if (num_samples == 0) {
+      std::fill_n(output, BatchSize, static_cast<Type>(0.0));
+      return;
+    }
+
+    const Type* sample_wavelengths = wavelengths_.data() + start;
+    const Type* sample_powers = spectral_powers_.data() + start;
+
+    Type first = sample_wavelengths[0];
+    Type last = sample_wavelengths[num_samples - 1];
+
+    // Find the last sample at or below each wavelength. 32-bit indices allow
+    // the loads to be performed as vector gathers.
+    std::array<uint32_t, BatchSize> lower = {};
+    if (Type spacing = spacings_[spectrum]; spacing != static_cast<Type>(0.0)) {
+      // Since the position of every sample divides out exactly, the position
+      // of a wavelength between two samples rounds down to either the lower
+      // sample or, if it is very close to it, the upper one
+      Type max_index = static_cast<Type>(num_samples - 1);
+      for (size_t k = 0; k < BatchSize; k++) {
+        Type position = (wavelengths[k] - first) / spacing;
+        position = (position >= static_cast<Type>(0.0))
+                       ? position
+                       : static_cast<Type>(0.0);
+        position = (max_index < position) ? max_index : position;
+
+        uint32_t index = static_cast<uint32_t>(position);
+        lower[k] = index - static_cast<uint32_t>(
+                               (index > 0) &
+                               (wavelengths[k] < sample_wavelengths[index]));
+      }
+    } else {
+      // Branchless binary search
+      for (uint32_t length = static_cast<uint32_t>(num_samples); length > 1;) {
+        uint32_t half = length / 2;
+        for (size_t k = 0; k < BatchSize; k++) {
+          uint32_t middle = lower[k] + half;
+          lower[k] += static_cast<uint32_t>(sample_wavelengths[middle] <=
+                                            wavelengths[k]) *
+                      half;
+        }
+        length -= half;
+      }
+    }
+
+    // Each spectrum is followed by a sample at infinity with the same spectral
+    // power as its last sample, so the sample after `lower` always exists and
+    // interpolating at the last wavelength needs no special case. Wavelengths
+    // are clamped to the sampled range to keep the interpolated value finite
+    // and are then zeroed by multiplying with a mask rather than selected,
+    // which the compiler would otherwise turn into a branch around the
+    // interpolation.
+    for (size_t k = 0; k < BatchSize; k++) {
+      Type inside = static_cast<Type>((first <= wavelengths[k]) &
+                                      (wavelengths[k] <= last));
+      Type wavelength = (wavelengths[k] < first) ? first : wavelengths[k];
+      wavelength = (last < wavelength) ? last : wavelength;
+
+      uint32_t upper = lower[k] + 1;
+      Type lower_wavelength = sample_wavelengths[lower[k]];
+      Type lower_power = sample_powers[lower[k]];
+      Type t = (wavelength - lower_wavelength) /
+               (sample_wavelengths[upper] - lower_wavelength);
+      Type value = lower_power + t * (sample_powers[upper] - lower_power);
+
+      output[k] = value * inside;
+    }
+  }
+
+  std::vector<std::pair<size_t, size_t>> ranges_;
+  std::vector<Type> spacings_;
+  std::vector<Type, CacheAlignedAllocator<Type>> wavelengths_;
+  std::vector<Type, CacheAlignedAllocator<Type>> spectral_powers_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_SPECTRUM_SET_
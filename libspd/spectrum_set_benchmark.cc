@@ -0,0 +1,145 @@
+// Compares evaluating a SpectrumSet against interpolating each spectrum with
+// std::map::lower_bound for the small numbers of wavelengths typically
+// evaluated at once by a spectral renderer.
+//
+// Build with optimizations enabled, for instance:
+//   bazel run -c opt //libspd:spectrum_set_benchmark
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "libspd/spectrum_set.h"
+
+namespace libspd {
+namespace {
+
+constexpr size_t kNumSpectra = 64;
+constexpr size_t kNumIterations = 10000;
+constexpr size_t kNumRepetitions = 5;
+
+// Makes spectra sampled every 5nm from 380nm to 780nm. If `irregular` is
+// true, each wavelength is instead moved by up to 2nm so that the samples are
+// not uniformly spaced.
+std::vector<std::map<float, float>> MakeSpectra(bool irregular) {
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> power(0.0f, 1.0f);
+  std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+
+  std::vector<std::map<float, float>> spectra(kNumSpectra);
+  for (std::map<float, float>& spectrum : spectra) {
+    for (float wavelength = 380.0f; wavelength <= 780.0f; wavelength += 5.0f) {
+      spectrum[irregular ? wavelength + offset(generator) : wavelength] =
+          power(generator);
+    }
+  }
+
+  return spectra;
+}
+
+std::vector<float> MakeWavelengths(size_t count) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> wavelength(360.0f, 800.0f);
+
+  std::vector<float> wavelengths(count);
+  for (float& value : wavelengths) {
+    value = wavelength(generator);
+  }
+
+  return wavelengths;
+}
+
+void EvaluateMaps(const std::vector<std::map<float, float>>& spectra,
+                  std::span<const float> wavelengths,
+                  std::span<float> output) {
+  for (size_t i = 0; i < spectra.size(); i++) {
+    for (size_t k = 0; k < wavelengths.size(); k++) {
+      float value = 0.0f;
+      auto upper = spectra[i].lower_bound(wavelengths[k]);
+      if (upper != spectra[i].end()) {
+        if (upper->first == wavelengths[k]) {
+          value = upper->second;
+        } else if (upper != spectra[i].begin()) {
+          auto lower = std::prev(upper);
+          float t = (wavelengths[k] - lower->first) /
+                    (upper->first - lower->first);
+          value = lower->second + t * (upper->second - lower->second);
+        }
+      }
+
+      output[i * wavelengths.size() + k] = value;
+    }
+  }
+}
+
+// Returns the average number of microseconds taken by `evaluate`, which is
+// passed a different set of `num_wavelengths` wavelengths on each iteration
+template <typename Function>
+double Measure(size_t num_wavelengths, Function evaluate) {
+  std::vector<float> wavelengths =
+      MakeWavelengths(num_wavelengths * kNumIterations);
+  std::vector<float> output(kNumSpectra * num_wavelengths);
+
+  // The fastest of several repetitions is reported to reduce the effect of
+  // other processes running on the same machine
+  double fastest = std::numeric_limits<double>::infinity();
+  float checksum = 0.0f;
+  for (size_t repetition = 0; repetition < kNumRepetitions; repetition++) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kNumIterations; i++) {
+      evaluate(std::span<const float>(wavelengths)
+                   .subspan(i * num_wavelengths, num_wavelengths),
+               std::span<float>(output));
+      checksum += output[i % output.size()];
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double elapsed =
+        std::chrono::duration<double, std::micro>(end - start).count();
+    fastest = std::min(fastest, elapsed / kNumIterations);
+  }
+
+  // Printing the checksum keeps the evaluations from being optimized away
+  std::fprintf(stderr, "checksum %f\n", checksum);
+
+  return fastest;
+}
+
+}  // namespace
+}  // namespace libspd
+
+int main() {
+  for (bool irregular : {false, true}) {
+    std::vector<std::map<float, float>> spectra =
+        libspd::MakeSpectra(irregular);
+    libspd::SpectrumSet<float> spectrum_set(spectra);
+
+    std::printf("%zu %s spectra of %zu samples\n", spectra.size(),
+                irregular ? "irregularly sampled" : "uniformly sampled",
+                spectra[0].size());
+    std::printf("%11s %16s %16s\n", "wavelengths", "SpectrumSet (us)",
+                "std::map (us)");
+    for (size_t num_wavelengths : {1, 4, 8, 16, 32}) {
+      double batched = libspd::Measure(
+          num_wavelengths,
+          [&](std::span<const float> wavelengths, std::span<float> output) {
+            spectrum_set.Evaluate(wavelengths, output);
+          });
+      double maps = libspd::Measure(
+          num_wavelengths,
+          [&](std::span<const float> wavelengths, std::span<float> output) {
+            libspd::EvaluateMaps(spectra, wavelengths, output);
+          });
+      std::printf("%11zu %16.2f %16.2f\n", num_wavelengths, batched, maps);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+#include "libspd/spectrum_set.h"
+
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <vector>
+
+#include "googlemock/include/gmock/gmock.h"
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+namespace {
+
+using ::testing::ElementsAre;
+
+TEST(SpectrumSet, Empty) {
+  SpectrumSet<float> spectrum_set;
+  EXPECT_EQ(0u, spectrum_set.size());
+
+  std::vector<float> wavelengths = {1.0, 2.0};
+  std::vector<float> output;
+  spectrum_set.Evaluate(wavelengths, output);
+}
+
+TEST(SpectrumSet, EmptySpectrum) {
+  std::vector<std::map<float, float>> spectra(1);
+  SpectrumSet<float> spectrum_set(spectra);
+  EXPECT_EQ(1u, spectrum_set.size());
+
+  std::vector<float> wavelengths = {1.0, 2.0};
+  std::vector<float> output(2, 1.0);
+  spectrum_set.Evaluate(wavelengths, output);
+  EXPECT_THAT(output, ElementsAre(0.0, 0.0));
+}
+
+TEST(SpectrumSet, SingleSample) {
+  std::vector<std::map<float, float>> spectra = {{{2.0, 3.0}}};
+  SpectrumSet<float> spectrum_set(spectra);
+
+  std::vector<float> wavelengths = {1.0, 2.0, 3.0};
+  std::vector<float> output(3);
+  spectrum_set.Evaluate(wavelengths, output);
+  EXPECT_THAT(output, ElementsAre(0.0, 3.0, 0.0));
+}
+
+TEST(SpectrumSet, Interpolates) {
+  std::vector<std::map<float, float>> spectra = {
+      {{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}},
+      {{2.0, 1.0}, {4.0, 0.0}},
+  };
+  SpectrumSet<float> spectrum_set(spectra);
+  EXPECT_EQ(2u, spectrum_set.size());
+
+  std::vector<float> wavelengths = {0.5, 1.0, 2.0, 3.0, 4.5, 5.0, 5.5};
+  std::vector<float> output(14);
+  spectrum_set.Evaluate(wavelengths, output);
+  EXPECT_THAT(output, ElementsAre(0.0, 2.0, 3.0, 4.0, 5.5, 6.0, 0.0,  //
+                                  0.0, 0.0, 1.0, 0.5, 0.0, 0.0, 0.0));
+}
+
+TEST(SpectrumSet, FullCacheLine) {
+  std::vector<std::map<float, float>> spectra(2);
+  for (size_t i = 0; i < 16; i++) {
+    spectra[0][static_cast<float>(i + 1)] = static_cast<float>(2 * i);
+  }
+  spectra[1] = {{1.0, 1.0}, {2.0, 2.0}};
+  SpectrumSet<float> spectrum_set(spectra);
+
+  std::vector<float> wavelengths = {15.5, 16.0, 16.5};
+  std::vector<float> output(6);
+  spectrum_set.Evaluate(wavelengths, output);
+  EXPECT_THAT(output, ElementsAre(29.0, 30.0, 0.0, 0.0, 0.0, 0.0));
+}
+
+template <typename Type>
+void ExpectMatchesScalarEvaluation(
+    const std::vector<std::map<Type, Type>>& spectra,
+    const std::vector<Type>& wavelengths) {
+  SpectrumSet<Type> spectrum_set(spectra);
+
+  std::vector<Type> output(spectra.size() * wavelengths.size());
+  spectrum_set.Evaluate(wavelengths, output);
+
+  for (size_t i = 0; i < spectra.size(); i++) {
+    for (size_t k = 0; k < wavelengths.size(); k++) {
+      Type expected = 0.0;
+      auto upper = spectra[i].lower_bound(wavelengths[k]);
+      if (upper != spectra[i].end()) {
+        if (upper->first == wavelengths[k]) {
+          expected = upper->second;
+        } else if (upper != spectra[i].begin()) {
+          auto lower = std::prev(upper);
+          Type t = (wavelengths[k] - lower->first) /
+                   (upper->first - lower->first);
+          expected = lower->second + t * (upper->second - lower->second);
+        }
+      }
+
+      EXPECT_EQ(expected, output[i * wavelengths.size() + k])
+          << "spectrum " << i << " at " << wavelengths[k];
+    }
+  }
+}
+
+TEST(SpectrumSet, MatchesScalarEvaluation) {
+  std::vector<std::map<double, double>> spectra(5);
+  for (size_t i = 0; i < spectra.size(); i++) {
+    for (size_t j = 0; j < 10 * i + 1; j++) {
+      spectra[i][360.0 + 7.0 * j] = static_cast<double>(i + j % 3);
+    }
+  }
+
+  std::vector<double> wavelengths;
+  for (double wavelength = 350.0; wavelength < 700.0; wavelength += 3.25) {
+    wavelengths.push_back(wavelength);
+  }
+
+  ExpectMatchesScalarEvaluation(spectra, wavelengths);
+}
+
+TEST(SpectrumSet, IrregularSpacing) {
+  std::vector<std::map<double, double>> spectra(3);
+  for (size_t i = 0; i < spectra.size(); i++) {
+    double wavelength = 360.0;
+    for (size_t j = 0; j < 20 * i + 2; j++) {
+      spectra[i][wavelength] = static_cast<double>(i + j % 4);
+      wavelength += 1.0 + static_cast<double>((j * 7) % 5);
+    }
+  }
+
+  std::vector<double> wavelengths;
+  for (double wavelength = 350.0; wavelength < 500.0; wavelength += 0.75) {
+    wavelengths.push_back(wavelength);
+  }
+
+  ExpectMatchesScalarEvaluation(spectra, wavelengths);
+}
+
+TEST(SpectrumSet, UniformSpacingNearSamples) {
+  std::vector<std::map<float, float>> spectra(2);
+  for (float wavelength = 380.0f; wavelength <= 780.0f; wavelength += 5.0f) {
+    spectra[0][wavelength] = wavelength / 1000.0f;
+  }
+  for (float wavelength = 400.0f; wavelength <= 700.0f; wavelength += 0.1f) {
+    spectra[1][wavelength] = wavelength / 1000.0f;
+  }
+
+  // Wavelengths on and immediately to either side of each sample
+  std::vector<float> wavelengths;
+  for (const auto& spectrum : spectra) {
+    for (const auto& [wavelength, spectral_power] : spectrum) {
+      wavelengths.push_back(std::nextafter(wavelength, 0.0f));
+      wavelengths.push_back(wavelength);
+      wavelengths.push_back(std::nextafter(wavelength, 1000.0f));
+    }
+  }
+
+  ExpectMatchesScalarEvaluation(spectra, wavelengths);
+}
+
+TEST(SpectrumSet, BatchSizes) {
+  std::vector<std::map<float, float>> spectra = {
+      {{1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}},
+      {{1.0, 0.0}, {4.0, 3.0}},
+  };
+
+  for (size_t num_wavelengths = 0; num_wavelengths <= 40; num_wavelengths++) {
+    std::vector<float> wavelengths;
+    for (size_t k = 0; k < num_wavelengths; k++) {
+      wavelengths.push_back(0.5f + 0.125f * static_cast<float>(k));
+    }
+
+    ExpectMatchesScalarEvaluation(spectra, wavelengths);
+  }
+}
+
+}  // namespace
+}  // namespace libspd
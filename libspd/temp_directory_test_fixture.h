@@ -0,0 +1,48 @@
+#ifndef _LIBSPD_TEMP_DIRECTORY_TEST_FIXTURE_
+#define _LIBSPD_TEMP_DIRECTORY_TEST_FIXTURE_
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "googletest/include/gtest/gtest.h"
+
+namespace libspd {
+
+// A fixture that gives each test an empty directory of its own, named after
+// the test and the process running it so that tests may run concurrently
+class TempDirectoryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const ::testing::TestInfo* test_info =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+    directory_ = std::filesystem::path(::testing::TempDir()) /
+                 (std::string(test_info->test_suite_name()) + "_" +
+                  std::to_string(getpid()) + "_" + test_info->name());
+    std::filesystem::remove_all(directory_);
+    std::filesystem::create_directories(directory_);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::string Path(const std::string& name) const {
+    return (directory_ / name).string();
+  }
+
+  // Replaces the contents of the file called `name` and returns its path
+  std::string WriteFile(const std::string& name,
+                        const std::string& contents) const {
+    std::string path = Path(name);
+    std::ofstream output(path, std::ios::out | std::ios::binary);
+    output << contents;
+    return path;
+  }
+
+  std::filesystem::path directory_;
+};
+
+}  // namespace libspd
+
+#endif  // _LIBSPD_TEMP_DIRECTORY_TEST_FIXTURE_